@@ -0,0 +1,62 @@
+#ifndef AVL_H
+#define AVL_H
+
+#include "Tree.h"
+
+// AVL树：任一节点左右子树高度差不超过1，树高始终为O(log n)
+// 接口与BST相同；插入至多一次旋转即可恢复平衡，删除可能沿途旋转O(log n)次。
+// 各节点高度、子树规模随插入、删除增量维护，depth()直接读取根节点高度。
+template <typename T>
+class AVL : public BST<T> {
+private:
+    static int balFac(const TreeNode<T>* x) {
+        return BinaryTree<T>::stature(x->left) - BinaryTree<T>::stature(x->right);
+    }
+
+    static bool avlBalanced(const TreeNode<T>* x) {
+        int bf = balFac(x);
+        return -2 < bf && bf < 2;
+    }
+
+    // 更高的孩子；等高时取与父亲同侧者（保证单旋）
+    static TreeNode<T>* tallerChild(TreeNode<T>* x) {
+        int l = BinaryTree<T>::stature(x->left), r = BinaryTree<T>::stature(x->right);
+        if (l > r) return x->left;
+        if (l < r) return x->right;
+        if (!x->parent) return x->left;
+        return (x == x->parent->left) ? x->left : x->right;
+    }
+
+public:
+    // 插入元素，已存在时返回nullptr
+    TreeNode<T>* insert(const T& val) {
+        TreeNode<T>* hot;
+        if (this->searchIn(val, hot)) return nullptr;
+        TreeNode<T>* x = this->attach(val, hot);
+        // 自父亲向上找到第一个失衡的祖先，一次旋转后全树恢复平衡
+        for (TreeNode<T>* g = hot; g; g = g->parent) {
+            if (!avlBalanced(g)) {
+                g = this->rotateAt(tallerChild(tallerChild(g)));
+                this->updateAbove(g->parent);  // 更高的祖先不再失衡，但子树规模仍需更新
+                break;
+            }
+            this->update(g);
+        }
+        return x;
+    }
+
+    // 删除元素
+    bool remove(const T& val) {
+        TreeNode<T>* node = this->search(val);
+        if (!node) return false;
+        TreeNode<T>* hot = this->removeAt(node);
+        // 失衡可能逐层向上传播，需检查到根
+        for (TreeNode<T>* g = hot; g; g = g->parent) {
+            if (!avlBalanced(g)) g = this->rotateAt(tallerChild(tallerChild(g)));
+            this->update(g);
+        }
+        return true;
+    }
+};
+
+#endif // AVL_H
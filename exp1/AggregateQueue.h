@@ -0,0 +1,213 @@
+#ifndef AGGREGATE_QUEUE_H
+#define AGGREGATE_QUEUE_H
+
+#include "Stack.h"
+#include "Deque.h"
+#include "Vector.h"
+#include <cassert>
+#include <algorithm>
+
+// 常用的结合律运算
+template <typename T>
+struct SumOp {
+    T operator()(const T& a, const T& b) const { return a + b; }
+};
+
+template <typename T>
+struct MinOp {
+    T operator()(const T& a, const T& b) const { return b < a ? b : a; }
+};
+
+template <typename T>
+struct MaxOp {
+    T operator()(const T& a, const T& b) const { return a < b ? b : a; }
+};
+
+// 聚合队列：双栈实现的队列，额外维护队内全部元素按入队次序的聚合值
+// 入栈 _in 保存 (元素, 自栈底起的前缀聚合)，出栈 _out 保存 (元素, 自栈顶起的后缀聚合)；
+// _out 为空时把 _in 整体倒入 _out，每个元素至多搬移一次，各操作均摊 O(1)。
+// Op 只需满足结合律（不要求交换律与可逆性），如求和、最小值、最大值、gcd 等。
+template <typename T, typename Op = SumOp<T> >
+class AggregateQueue {
+private:
+    struct Entry {
+        T value;  // 元素
+        T agg;    // 聚合值
+    };
+
+    Stack<Entry> _in;   // 入队端
+    Stack<Entry> _out;  // 出队端
+    Op _op;
+
+    // 把 _in 中的元素倒入 _out，并重新计算后缀聚合
+    void transfer() {
+        while (!_in.empty()) {
+            Entry e = _in.pop();
+            e.agg = _out.empty() ? e.value : _op(e.value, _out.top().agg);
+            _out.push(e);
+        }
+    }
+
+public:
+    AggregateQueue(const Op& op = Op()) : _op(op) {}
+
+    int size() const { return _in.size() + _out.size(); }
+    bool empty() const { return _in.empty() && _out.empty(); }
+
+    // 入队
+    void enqueue(const T& v) {
+        Entry e;
+        e.value = v;
+        e.agg = _in.empty() ? v : _op(_in.top().agg, v);
+        _in.push(e);
+    }
+
+    // 出队
+    T dequeue() {
+        assert(!empty() && "AggregateQueue is empty!");
+        if (_out.empty()) transfer();
+        return _out.pop().value;
+    }
+
+    // 队头元素
+    const T& front() {
+        assert(!empty() && "AggregateQueue is empty!");
+        if (_out.empty()) transfer();
+        return _out.top().value;
+    }
+
+    // 队内全部元素的聚合值，O(1)
+    T aggregate() const {
+        assert(!empty() && "AggregateQueue is empty!");
+        if (_out.empty()) return _in.top().agg;
+        if (_in.empty()) return _out.top().agg;
+        return _op(_out.top().agg, _in.top().agg);
+    }
+
+    // 清空队列
+    void clear() {
+        _in.clear();
+        _out.clear();
+    }
+};
+
+// 单调队列：滑动窗口最值的特化实现
+// Deque 中保存窗口内可能成为最值的元素（下标递增、值单调），被更优的新元素支配者直接丢弃，
+// 每个元素至多入队、出队各一次。IsMin 为真时维护最小值，否则维护最大值。
+template <typename T, bool IsMin = true>
+class MonotonicQueue {
+private:
+    struct Entry {
+        T value;   // 元素
+        long idx;  // 入队序号
+    };
+
+    Deque<Entry> _dq;  // 单调候选序列
+    long _head;        // 队头元素的入队序号
+    long _tail;        // 下一个入队序号
+
+    static bool better(const T& a, const T& b) {
+        return IsMin ? (a < b) : (b < a);
+    }
+
+public:
+    MonotonicQueue() : _head(0), _tail(0) {}
+
+    int size() const { return (int)(_tail - _head); }
+    bool empty() const { return _tail == _head; }
+
+    // 入队：丢弃被新元素支配的候选
+    void enqueue(const T& v) {
+        while (!_dq.empty() && !better(_dq.back().value, v)) _dq.pop_back();
+        Entry e;
+        e.value = v;
+        e.idx = _tail++;
+        _dq.push_back(e);
+    }
+
+    // 出队（窗口左端右移一格）
+    void dequeue() {
+        assert(!empty() && "MonotonicQueue is empty!");
+        if (_dq.front().idx == _head) _dq.pop_front();
+        _head++;
+    }
+
+    // 队内最值，O(1)
+    const T& aggregate() const {
+        assert(!empty() && "MonotonicQueue is empty!");
+        return _dq.front().value;
+    }
+
+    // 清空队列
+    void clear() {
+        _dq.clear();
+        _head = _tail = 0;
+    }
+};
+
+// 流式滑动窗口：每输入一个元素，窗口右移一格，窗口满后回调输出当前窗口的聚合值
+// Q 可以是 AggregateQueue 或 MonotonicQueue
+template <typename T, typename Q>
+class SlidingWindow {
+private:
+    Q _q;         // 窗口内容
+    int _width;   // 窗口宽度
+
+public:
+    SlidingWindow(int width) : _width(width) {
+        assert(width > 0);
+    }
+
+    // 输入一个元素；窗口已满时返回 true 并通过 out 给出聚合值
+    bool push(const T& v, T& out) {
+        _q.enqueue(v);
+        if (_q.size() > _width) _q.dequeue();
+        if (_q.size() < _width) return false;
+        out = _q.aggregate();
+        return true;
+    }
+
+    // 输入一个元素，窗口已满时把聚合值交给 visit
+    template <typename VST>
+    void push(const T& v, VST& visit) {
+        T out;
+        if (push(v, out)) visit(out);
+    }
+
+    void clear() { _q.clear(); }
+};
+
+// 对整个数组计算宽度为 width 的滑动窗口最小值，结果共 n - width + 1 项
+template <typename T>
+Vector<T> slidingWindowMin(const Vector<T>& a, int width) {
+    SlidingWindow<T, MonotonicQueue<T, true> > w(width);
+    Vector<T> result;
+    T out;
+    for (int i = 0; i < a.size(); ++i)
+        if (w.push(a[i], out)) result.push_back(out);
+    return result;
+}
+
+// 对整个数组计算宽度为 width 的滑动窗口最大值
+template <typename T>
+Vector<T> slidingWindowMax(const Vector<T>& a, int width) {
+    SlidingWindow<T, MonotonicQueue<T, false> > w(width);
+    Vector<T> result;
+    T out;
+    for (int i = 0; i < a.size(); ++i)
+        if (w.push(a[i], out)) result.push_back(out);
+    return result;
+}
+
+// 对整个数组计算宽度为 width 的滑动窗口和
+template <typename T>
+Vector<T> slidingWindowSum(const Vector<T>& a, int width) {
+    SlidingWindow<T, AggregateQueue<T, SumOp<T> > > w(width);
+    Vector<T> result;
+    T out;
+    for (int i = 0; i < a.size(); ++i)
+        if (w.push(a[i], out)) result.push_back(out);
+    return result;
+}
+
+#endif // AGGREGATE_QUEUE_H
@@ -0,0 +1,453 @@
+#ifndef BPLUS_TREE_H
+#define BPLUS_TREE_H
+
+#include "Vector.h"
+#include <cassert>
+
+// B+树：关键码全部存放在叶节点，叶节点串成双向链表以支持顺序范围扫描
+// 节点大小由 NODE_BYTES 决定（默认 256 字节，即 4 个缓存行），每层只需一次节点访问；
+// 节点内用无分支二分查找（比较结果转化为条件传送），避免分支预测失败。
+template <typename T, int NODE_BYTES = 256>
+class BPlusTree {
+private:
+    static const int LEAF_RAW = (NODE_BYTES - 2 * (int)sizeof(void*) - 2 * (int)sizeof(int)) / (int)sizeof(T);
+    static const int INNER_RAW = (NODE_BYTES - 2 * (int)sizeof(int) - (int)sizeof(void*)) / ((int)sizeof(T) + (int)sizeof(void*));
+    static const int LEAF_CAP = LEAF_RAW > 4 ? LEAF_RAW : 4;     // 叶节点关键码上限
+    static const int INNER_CAP = INNER_RAW > 4 ? INNER_RAW : 4;  // 内部节点关键码上限（孩子数多一个）
+    static const int MAX_DEPTH = 64;
+
+    struct Node {
+        bool leaf;  // 是否为叶节点
+        int count;  // 关键码数
+    };
+
+    struct Leaf : Node {
+        T keys[LEAF_CAP];
+        Leaf* prev;
+        Leaf* next;
+    };
+
+    // keys[i] 为 child[i + 1] 子树中的最小关键码（分隔码）
+    struct Inner : Node {
+        T keys[INNER_CAP];
+        Node* child[INNER_CAP + 1];
+    };
+
+    Node* root;    // 根节点
+    Leaf* head;    // 最左叶节点
+    int size;      // 关键码总数
+    int height;    // 层数（空树为 0）
+
+    static Leaf* asLeaf(Node* x) { return static_cast<Leaf*>(x); }
+    static Inner* asInner(Node* x) { return static_cast<Inner*>(x); }
+
+    static Leaf* newLeaf() {
+        Leaf* x = new Leaf;
+        x->leaf = true;
+        x->count = 0;
+        x->prev = x->next = nullptr;
+        return x;
+    }
+
+    static Inner* newInner() {
+        Inner* x = new Inner;
+        x->leaf = false;
+        x->count = 0;
+        return x;
+    }
+
+    // 无分支二分：有序数组 a[0, n) 中小于 key 的元素个数
+    static int lowerBound(const T* a, int n, const T& key) {
+        const T* base = a;
+        while (n > 1) {
+            int half = n / 2;
+            base = (base[half - 1] < key) ? base + half : base;
+            n -= half;
+        }
+        return (int)(base - a) + (n == 1 && *base < key);
+    }
+
+    // 无分支二分：有序数组 a[0, n) 中不大于 key 的元素个数
+    static int upperBound(const T* a, int n, const T& key) {
+        const T* base = a;
+        while (n > 1) {
+            int half = n / 2;
+            base = (key < base[half - 1]) ? base : base + half;
+            n -= half;
+        }
+        return (int)(base - a) + (n == 1 && !(key < *base));
+    }
+
+    // 自根向下找到 key 所在的叶节点，path/idx 记录沿途内部节点及所走的孩子序号
+    Leaf* descend(const T& key, Inner** path, int* idx, int& depth) const {
+        Node* x = root;
+        depth = 0;
+        while (!x->leaf) {
+            Inner* in = asInner(x);
+            int i = upperBound(in->keys, in->count, key);
+            path[depth] = in;
+            idx[depth++] = i;
+            x = in->child[i];
+        }
+        return asLeaf(x);
+    }
+
+    // 在内部节点 p 的第 i 个分隔码处插入 (sep, right)，right 成为 child[i + 1]
+    static void innerInsert(Inner* p, int i, const T& sep, Node* right) {
+        for (int j = p->count; j > i; --j) {
+            p->keys[j] = p->keys[j - 1];
+            p->child[j + 1] = p->child[j];
+        }
+        p->keys[i] = sep;
+        p->child[i + 1] = right;
+        p->count++;
+    }
+
+    // 删除内部节点 p 的第 i 个分隔码及其右侧孩子
+    static void innerErase(Inner* p, int i) {
+        for (int j = i; j < p->count - 1; ++j) {
+            p->keys[j] = p->keys[j + 1];
+            p->child[j + 1] = p->child[j + 2];
+        }
+        p->count--;
+    }
+
+    // 分裂已满的叶节点，返回新的右兄弟
+    Leaf* splitLeaf(Leaf* x) {
+        Leaf* y = newLeaf();
+        int half = x->count / 2;
+        for (int i = half; i < x->count; ++i) y->keys[i - half] = x->keys[i];
+        y->count = x->count - half;
+        x->count = half;
+        y->next = x->next;
+        if (y->next) y->next->prev = y;
+        y->prev = x;
+        x->next = y;
+        return y;
+    }
+
+    // 向已满的内部节点插入 (sep, right) 并分裂，返回新的右兄弟，up 为上交的分隔码
+    Inner* splitInner(Inner* x, int i, const T& sep, Node* right, T& up) {
+        T keys[INNER_CAP + 1];
+        Node* child[INNER_CAP + 2];
+        for (int j = 0; j < x->count; ++j) keys[j] = x->keys[j];
+        for (int j = 0; j <= x->count; ++j) child[j] = x->child[j];
+        for (int j = x->count; j > i; --j) {
+            keys[j] = keys[j - 1];
+            child[j + 1] = child[j];
+        }
+        keys[i] = sep;
+        child[i + 1] = right;
+
+        int total = x->count + 1;
+        int mid = total / 2;
+        Inner* y = newInner();
+        x->count = mid;
+        for (int j = 0; j < mid; ++j) x->keys[j] = keys[j];
+        for (int j = 0; j <= mid; ++j) x->child[j] = child[j];
+        up = keys[mid];
+        y->count = total - mid - 1;
+        for (int j = 0; j < y->count; ++j) y->keys[j] = keys[mid + 1 + j];
+        for (int j = 0; j <= y->count; ++j) y->child[j] = child[mid + 1 + j];
+        return y;
+    }
+
+    // 叶节点下溢：向兄弟借或与兄弟合并
+    void fixLeaf(Leaf* x, Inner* p, int i) {
+        Leaf* l = i > 0 ? asLeaf(p->child[i - 1]) : nullptr;
+        Leaf* r = i < p->count ? asLeaf(p->child[i + 1]) : nullptr;
+        if (l && l->count > LEAF_CAP / 2) {
+            for (int j = x->count; j > 0; --j) x->keys[j] = x->keys[j - 1];
+            x->keys[0] = l->keys[--l->count];
+            x->count++;
+            p->keys[i - 1] = x->keys[0];
+        } else if (r && r->count > LEAF_CAP / 2) {
+            x->keys[x->count++] = r->keys[0];
+            for (int j = 0; j < r->count - 1; ++j) r->keys[j] = r->keys[j + 1];
+            r->count--;
+            p->keys[i] = r->keys[0];
+        } else if (l) {
+            mergeLeaves(p, i - 1);
+        } else {
+            mergeLeaves(p, i);
+        }
+    }
+
+    // 合并 p->child[i] 与 p->child[i + 1] 两个叶节点
+    void mergeLeaves(Inner* p, int i) {
+        Leaf* a = asLeaf(p->child[i]);
+        Leaf* b = asLeaf(p->child[i + 1]);
+        for (int j = 0; j < b->count; ++j) a->keys[a->count + j] = b->keys[j];
+        a->count += b->count;
+        a->next = b->next;
+        if (a->next) a->next->prev = a;
+        delete b;
+        innerErase(p, i);
+    }
+
+    // 内部节点下溢：经父节点旋转借码，或与兄弟合并（拉下分隔码）
+    void fixInner(Inner* x, Inner* p, int i) {
+        Inner* l = i > 0 ? asInner(p->child[i - 1]) : nullptr;
+        Inner* r = i < p->count ? asInner(p->child[i + 1]) : nullptr;
+        if (l && l->count > INNER_CAP / 2) {
+            for (int j = x->count; j > 0; --j) x->keys[j] = x->keys[j - 1];
+            for (int j = x->count + 1; j > 0; --j) x->child[j] = x->child[j - 1];
+            x->keys[0] = p->keys[i - 1];
+            x->child[0] = l->child[l->count];
+            x->count++;
+            p->keys[i - 1] = l->keys[--l->count];
+        } else if (r && r->count > INNER_CAP / 2) {
+            x->keys[x->count] = p->keys[i];
+            x->child[x->count + 1] = r->child[0];
+            x->count++;
+            p->keys[i] = r->keys[0];
+            for (int j = 0; j < r->count - 1; ++j) r->keys[j] = r->keys[j + 1];
+            for (int j = 0; j < r->count; ++j) r->child[j] = r->child[j + 1];
+            r->count--;
+        } else if (l) {
+            mergeInners(p, i - 1);
+        } else {
+            mergeInners(p, i);
+        }
+    }
+
+    // 合并 p->child[i] 与 p->child[i + 1] 两个内部节点
+    void mergeInners(Inner* p, int i) {
+        Inner* a = asInner(p->child[i]);
+        Inner* b = asInner(p->child[i + 1]);
+        a->keys[a->count] = p->keys[i];
+        for (int j = 0; j < b->count; ++j) a->keys[a->count + 1 + j] = b->keys[j];
+        for (int j = 0; j <= b->count; ++j) a->child[a->count + 1 + j] = b->child[j];
+        a->count += b->count + 1;
+        delete b;
+        innerErase(p, i);
+    }
+
+    static void destroy(Node* x) {
+        if (!x) return;
+        if (x->leaf) {
+            delete asLeaf(x);
+            return;
+        }
+        Inner* in = asInner(x);
+        for (int i = 0; i <= in->count; ++i) destroy(in->child[i]);
+        delete in;
+    }
+
+public:
+    // 构造函数
+    BPlusTree() : root(nullptr), head(nullptr), size(0), height(0) {}
+
+    // 由严格递增的 Vector 批量构建
+    BPlusTree(const Vector<T>& sorted) : root(nullptr), head(nullptr), size(0), height(0) {
+        build(sorted);
+    }
+
+    // 析构函数
+    ~BPlusTree() {
+        clear();
+    }
+
+    BPlusTree(const BPlusTree&) = delete;
+    BPlusTree& operator=(const BPlusTree&) = delete;
+
+    bool empty() const { return size == 0; }
+    int getSize() const { return size; }
+    int depth() const { return height - 1; }
+
+    // 清空
+    void clear() {
+        destroy(root);
+        root = nullptr;
+        head = nullptr;
+        size = 0;
+        height = 0;
+    }
+
+    // 查找元素，返回指向叶节点中关键码的指针，不存在时返回 nullptr
+    const T* search(const T& val) const {
+        if (!root) return nullptr;
+        Inner* path[MAX_DEPTH];
+        int idx[MAX_DEPTH];
+        int d;
+        Leaf* x = descend(val, path, idx, d);
+        int i = lowerBound(x->keys, x->count, val);
+        return (i < x->count && !(val < x->keys[i])) ? &x->keys[i] : nullptr;
+    }
+
+    // 插入元素，已存在时返回 false
+    bool insert(const T& val) {
+        if (!root) {
+            head = newLeaf();
+            head->keys[0] = val;
+            head->count = 1;
+            root = head;
+            size = height = 1;
+            return true;
+        }
+        Inner* path[MAX_DEPTH];
+        int idx[MAX_DEPTH];
+        int d;
+        Leaf* x = descend(val, path, idx, d);
+        int i = lowerBound(x->keys, x->count, val);
+        if (i < x->count && !(val < x->keys[i])) return false;  // 不允许重复元素
+
+        if (x->count == LEAF_CAP) {
+            Leaf* y = splitLeaf(x);
+            if (i > x->count) {
+                i -= x->count;
+                x = y;
+            }
+            for (int j = x->count; j > i; --j) x->keys[j] = x->keys[j - 1];
+            x->keys[i] = val;
+            x->count++;
+
+            // 分隔码逐层上交，直到某层未满或生成新根
+            T sep = y->keys[0];
+            Node* right = y;
+            while (d > 0) {
+                Inner* p = path[--d];
+                int pi = idx[d];
+                if (p->count < INNER_CAP) {
+                    innerInsert(p, pi, sep, right);
+                    right = nullptr;
+                    break;
+                }
+                T up;
+                right = splitInner(p, pi, sep, right, up);
+                sep = up;
+            }
+            if (right) {
+                Inner* r = newInner();
+                r->count = 1;
+                r->keys[0] = sep;
+                r->child[0] = root;
+                r->child[1] = right;
+                root = r;
+                height++;
+            }
+        } else {
+            for (int j = x->count; j > i; --j) x->keys[j] = x->keys[j - 1];
+            x->keys[i] = val;
+            x->count++;
+        }
+        size++;
+        return true;
+    }
+
+    // 删除元素
+    bool remove(const T& val) {
+        if (!root) return false;
+        Inner* path[MAX_DEPTH];
+        int idx[MAX_DEPTH];
+        int d;
+        Leaf* x = descend(val, path, idx, d);
+        int i = lowerBound(x->keys, x->count, val);
+        if (i == x->count || val < x->keys[i]) return false;
+
+        for (int j = i; j < x->count - 1; ++j) x->keys[j] = x->keys[j + 1];
+        x->count--;
+        size--;
+
+        if (d == 0) {  // 根为叶节点
+            if (x->count == 0) clear();
+            return true;
+        }
+        if (x->count >= LEAF_CAP / 2) return true;
+
+        fixLeaf(x, path[d - 1], idx[d - 1]);
+        // 下溢沿路径向上传播
+        for (int k = d - 1; k > 0; --k) {
+            if (path[k]->count >= INNER_CAP / 2) break;
+            fixInner(path[k], path[k - 1], idx[k - 1]);
+        }
+        // 根节点只剩一个孩子时降低树高
+        if (!root->leaf && root->count == 0) {
+            Inner* old = asInner(root);
+            root = old->child[0];
+            delete old;
+            height--;
+        }
+        return true;
+    }
+
+    // 由严格递增的 Vector 批量构建，O(n)：先均匀填满叶节点，再自底向上逐层建立索引
+    void build(const Vector<T>& sorted) {
+        clear();
+        int n = sorted.size();
+        if (n == 0) return;
+
+        int m = (n + LEAF_CAP - 1) / LEAF_CAP;  // 叶节点数
+        Vector<Node*> level(m);
+        Vector<T> mins(m);                       // 各子树的最小关键码
+        Leaf* prev = nullptr;
+        for (int k = 0, pos = 0; k < m; ++k) {
+            int cnt = n / m + (k < n % m ? 1 : 0);
+            Leaf* x = newLeaf();
+            for (int j = 0; j < cnt; ++j) x->keys[j] = sorted[pos + j];
+            x->count = cnt;
+            x->prev = prev;
+            if (prev) prev->next = x;
+            else head = x;
+            prev = x;
+            level.push_back(x);
+            mins.push_back(x->keys[0]);
+            pos += cnt;
+        }
+        height = 1;
+
+        while (level.size() > 1) {
+            int c = level.size();
+            int pm = (c + INNER_CAP) / (INNER_CAP + 1);  // 本层父节点数
+            Vector<Node*> up(pm);
+            Vector<T> upMins(pm);
+            for (int k = 0, pos = 0; k < pm; ++k) {
+                int cnt = c / pm + (k < c % pm ? 1 : 0);  // 孩子数
+                Inner* p = newInner();
+                for (int j = 0; j < cnt; ++j) {
+                    p->child[j] = level[pos + j];
+                    if (j > 0) p->keys[j - 1] = mins[pos + j];
+                }
+                p->count = cnt - 1;
+                up.push_back(p);
+                upMins.push_back(mins[pos]);
+                pos += cnt;
+            }
+            level = up;
+            mins = upMins;
+            height++;
+        }
+        root = level[0];
+        size = n;
+    }
+
+    // 范围查询：按升序访问 [lo, hi] 内的关键码，沿叶节点链表顺序扫描
+    template <typename VST>
+    void range(const T& lo, const T& hi, VST& visit) const {
+        if (!root) return;
+        Inner* path[MAX_DEPTH];
+        int idx[MAX_DEPTH];
+        int d;
+        Leaf* x = descend(lo, path, idx, d);
+        int i = lowerBound(x->keys, x->count, lo);
+        for (; x; x = x->next, i = 0) {
+            for (; i < x->count; ++i) {
+                if (hi < x->keys[i]) return;
+                visit(x->keys[i]);
+            }
+        }
+    }
+
+    // 中序（升序）遍历
+    template <typename VST>
+    void traverse(VST& visit) const {
+        for (Leaf* x = head; x; x = x->next)
+            for (int i = 0; i < x->count; ++i) visit(x->keys[i]);
+    }
+
+    void inOrder(void (*visit)(const T&)) const {
+        traverse(visit);
+    }
+};
+
+#endif // BPLUS_TREE_H
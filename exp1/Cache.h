@@ -0,0 +1,245 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include "List.h"
+#include <cassert>
+#include <cstddef>
+#include <unordered_map>
+
+// 缓存统计
+struct CacheStats {
+    long hits;       // 命中次数
+    long misses;     // 未命中次数
+    long evictions;  // 淘汰次数
+
+    CacheStats() : hits(0), misses(0), evictions(0) {}
+    double hitRatio() const {
+        return hits + misses ? double(hits) / (hits + misses) : 0.0;
+    }
+};
+
+// 默认按条目计容量：每个条目权重为 1
+template <typename K, typename V>
+struct UnitWeight {
+    size_t operator()(const K&, const V&) const { return 1; }
+};
+
+// 缓存条目
+template <typename K, typename V>
+struct CacheEntry {
+    K key;
+    V value;
+    size_t weight;   // 权重（条目数或字节数）
+    bool hot;        // 是否位于受保护段（仅 SLRU 使用）
+};
+
+// LRU 缓存：哈希索引 + List 维护最近使用次序
+// 哈希表把键映射到 List 节点，命中时用 splice 把节点移到表头，O(1) 且不申请内存。
+// 容量由 Weigher 计量：默认按条目数，也可传入按字节计算的函数对象。
+template <typename K, typename V, typename Weigher = UnitWeight<K, V> >
+class LRUCache {
+private:
+    typedef CacheEntry<K, V> Entry;
+    typedef ListNode<Entry>* Posi;
+
+    List<Entry> _list;                   // 表头最近使用，表尾最久未用
+    std::unordered_map<K, Posi> _index;  // 键 -> 节点
+    size_t _capacity;                    // 容量
+    size_t _weight;                      // 当前总权重
+    Weigher _weigher;
+    CacheStats _stats;
+
+    void evict() {
+        while (_weight > _capacity && !_list.empty()) {
+            Posi victim = _list.last();
+            _index.erase(victim->data.key);
+            _weight -= victim->data.weight;
+            _list.remove(victim);
+            _stats.evictions++;
+        }
+    }
+
+public:
+    LRUCache(size_t capacity, const Weigher& weigher = Weigher())
+        : _capacity(capacity), _weight(0), _weigher(weigher) {}
+
+    int size() const { return _list.size(); }
+    size_t weight() const { return _weight; }
+    size_t capacity() const { return _capacity; }
+    const CacheStats& stats() const { return _stats; }
+
+    // 查找：命中时返回值的指针并把条目移到表头，未命中返回 nullptr
+    V* get(const K& key) {
+        typename std::unordered_map<K, Posi>::iterator it = _index.find(key);
+        if (it == _index.end()) {
+            _stats.misses++;
+            return nullptr;
+        }
+        _stats.hits++;
+        Posi p = it->second;
+        _list.splice(_list.first(), _list, p);
+        return &p->data.value;
+    }
+
+    // 插入或更新，必要时淘汰最久未用的条目
+    void put(const K& key, const V& value) {
+        size_t w = _weigher(key, value);
+        typename std::unordered_map<K, Posi>::iterator it = _index.find(key);
+        if (it != _index.end()) {
+            Posi p = it->second;
+            _weight = _weight - p->data.weight + w;
+            p->data.value = value;
+            p->data.weight = w;
+            _list.splice(_list.first(), _list, p);
+        } else {
+            Entry e;
+            e.key = key;
+            e.value = value;
+            e.weight = w;
+            e.hot = false;
+            _index[key] = _list.insertAsFirst(e);
+            _weight += w;
+        }
+        evict();
+    }
+
+    // 删除
+    bool erase(const K& key) {
+        typename std::unordered_map<K, Posi>::iterator it = _index.find(key);
+        if (it == _index.end()) return false;
+        _weight -= it->second->data.weight;
+        _list.remove(it->second);
+        _index.erase(it);
+        return true;
+    }
+
+    bool contains(const K& key) const {
+        return _index.find(key) != _index.end();
+    }
+};
+
+// 分段 LRU（SLRU）缓存：近似 LFU，抵抗一次性扫描对热点数据的冲刷
+// 新条目进入试用段；在试用段中再次命中则晋升到受保护段。受保护段超过 protectedRatio
+// 时，其最久未用的条目降级回试用段表头；淘汰总是发生在试用段表尾。
+// 两段共享同一节点池，晋升与降级都只是 O(1) 的 splice。
+template <typename K, typename V, typename Weigher = UnitWeight<K, V> >
+class SLRUCache {
+private:
+    typedef CacheEntry<K, V> Entry;
+    typedef ListNode<Entry>* Posi;
+
+    List<Entry> _probation;              // 试用段
+    List<Entry> _protected;              // 受保护段
+    std::unordered_map<K, Posi> _index;  // 键 -> 节点
+    size_t _capacity;                    // 总容量
+    size_t _protectedCapacity;           // 受保护段容量
+    size_t _weight;                      // 总权重
+    size_t _protectedWeight;             // 受保护段权重
+    Weigher _weigher;
+    CacheStats _stats;
+
+    // 受保护段超额时降级
+    void demote() {
+        while (_protectedWeight > _protectedCapacity && !_protected.empty()) {
+            Posi p = _protected.last();
+            p->data.hot = false;
+            _protectedWeight -= p->data.weight;
+            _probation.splice(_probation.first(), _protected, p);
+        }
+    }
+
+    // 总权重超额时淘汰：先淘汰试用段，试用段为空时才动受保护段
+    void evict() {
+        while (_weight > _capacity) {
+            List<Entry>& victims = _probation.empty() ? _protected : _probation;
+            if (victims.empty()) break;
+            Posi victim = victims.last();
+            if (victim->data.hot) _protectedWeight -= victim->data.weight;
+            _index.erase(victim->data.key);
+            _weight -= victim->data.weight;
+            victims.remove(victim);
+            _stats.evictions++;
+        }
+    }
+
+    // 命中后的位置调整；晋升或更新权重都可能使受保护段超额，最后统一降级
+    void touch(Posi p) {
+        if (p->data.hot) {
+            _protected.splice(_protected.first(), _protected, p);
+        } else {
+            p->data.hot = true;
+            _protectedWeight += p->data.weight;
+            _protected.splice(_protected.first(), _probation, p);
+        }
+        demote();
+    }
+
+public:
+    SLRUCache(size_t capacity, double protectedRatio = 0.8, const Weigher& weigher = Weigher())
+        : _protected(_probation.pool()), _capacity(capacity),
+          _protectedCapacity((size_t)(capacity * protectedRatio)),
+          _weight(0), _protectedWeight(0), _weigher(weigher) {}
+
+    int size() const { return _probation.size() + _protected.size(); }
+    size_t weight() const { return _weight; }
+    size_t capacity() const { return _capacity; }
+    const CacheStats& stats() const { return _stats; }
+
+    // 查找：命中时返回值的指针并更新位置，未命中返回 nullptr
+    V* get(const K& key) {
+        typename std::unordered_map<K, Posi>::iterator it = _index.find(key);
+        if (it == _index.end()) {
+            _stats.misses++;
+            return nullptr;
+        }
+        _stats.hits++;
+        Posi p = it->second;
+        touch(p);
+        return &p->data.value;
+    }
+
+    // 插入或更新
+    void put(const K& key, const V& value) {
+        size_t w = _weigher(key, value);
+        typename std::unordered_map<K, Posi>::iterator it = _index.find(key);
+        if (it != _index.end()) {
+            Posi p = it->second;
+            _weight = _weight - p->data.weight + w;
+            if (p->data.hot) _protectedWeight = _protectedWeight - p->data.weight + w;
+            p->data.value = value;
+            p->data.weight = w;
+            touch(p);
+        } else {
+            Entry e;
+            e.key = key;
+            e.value = value;
+            e.weight = w;
+            e.hot = false;
+            _index[key] = _probation.insertAsFirst(e);
+            _weight += w;
+        }
+        evict();
+    }
+
+    // 删除
+    bool erase(const K& key) {
+        typename std::unordered_map<K, Posi>::iterator it = _index.find(key);
+        if (it == _index.end()) return false;
+        Posi p = it->second;
+        _weight -= p->data.weight;
+        if (p->data.hot) {
+            _protectedWeight -= p->data.weight;
+            _protected.remove(p);
+        } else {
+            _probation.remove(p);
+        }
+        _index.erase(it);
+        return true;
+    }
+
+    bool contains(const K& key) const {
+        return _index.find(key) != _index.end();
+    }
+};
+
+#endif // CACHE_H
@@ -0,0 +1,169 @@
+#ifndef COMPACT_BST_H
+#define COMPACT_BST_H
+
+#include "Vector.h"
+#include <cstdint>
+
+// 紧凑二叉搜索树节点：以32位下标代替指针，且不存父指针
+// 对于int关键码每个节点只占12字节（TreeNode<int>为40字节）
+template <typename T>
+struct CompactNode {
+    T data;
+    uint32_t left;   // 左孩子下标
+    uint32_t right;  // 右孩子下标（空闲时用作自由链表指针）
+};
+
+// 紧凑二叉搜索树：接口与BST相同，所有节点存放在同一个Vector中
+// 删除的节点串成自由链表供后续插入复用；clear整块释放节点数组。
+// 没有父指针，插入、删除沿途记录父节点；中序遍历用Morris线索化，无需辅助栈。
+template <typename T>
+class CompactBST {
+private:
+    typedef CompactNode<T> Node;
+    static const uint32_t NIL = 0xFFFFFFFFu;
+
+    Vector<Node> _nodes;  // 节点数组
+    uint32_t _root;       // 根节点下标
+    uint32_t _free;       // 自由链表头
+    int _size;            // 元素数
+
+    uint32_t alloc(const T& val) {
+        uint32_t x;
+        if (_free != NIL) {
+            x = _free;
+            _free = _nodes[x].right;
+        } else {
+            x = (uint32_t)_nodes.size();
+            _nodes.push_back(Node());
+        }
+        _nodes[x].data = val;
+        _nodes[x].left = _nodes[x].right = NIL;
+        return x;
+    }
+
+    void release(uint32_t x) {
+        _nodes[x].right = _free;
+        _free = x;
+    }
+
+    // 查找val：返回命中节点下标（未命中为NIL），hot为其父节点（未命中时为应插入位置的父节点）
+    uint32_t searchIn(const T& val, uint32_t& hot) const {
+        hot = NIL;
+        uint32_t x = _root;
+        while (x != NIL) {
+            const Node& n = _nodes[x];
+            if (val == n.data) return x;
+            hot = x;
+            x = (val < n.data) ? n.left : n.right;
+        }
+        return NIL;
+    }
+
+    // 父节点hot中指向x的字段（hot为NIL时是根）
+    uint32_t& fromParentTo(uint32_t hot, uint32_t x) {
+        if (hot == NIL) return _root;
+        return (_nodes[hot].left == x) ? _nodes[hot].left : _nodes[hot].right;
+    }
+
+public:
+    // 构造函数
+    CompactBST(int capacity = 16) : _nodes(capacity), _root(NIL), _free(NIL), _size(0) {}
+
+    bool empty() const { return _size == 0; }
+    int getSize() const { return _size; }
+
+    // 清空：整块释放节点数组
+    void clear() {
+        _nodes = Vector<Node>();
+        _root = _free = NIL;
+        _size = 0;
+    }
+
+    // 查找元素，不存在时返回nullptr
+    const T* search(const T& val) const {
+        uint32_t hot;
+        uint32_t x = searchIn(val, hot);
+        return x == NIL ? nullptr : &_nodes[x].data;
+    }
+
+    // 插入元素，已存在时返回false
+    bool insert(const T& val) {
+        uint32_t hot;
+        if (searchIn(val, hot) != NIL) return false;  // 不允许重复元素
+        uint32_t x = alloc(val);  // 可能搬迁节点数组，之后才按下标接入
+        if (hot == NIL) _root = x;
+        else if (val < _nodes[hot].data) _nodes[hot].left = x;
+        else _nodes[hot].right = x;
+        _size++;
+        return true;
+    }
+
+    // 删除元素
+    bool remove(const T& val) {
+        uint32_t hot;
+        uint32_t x = searchIn(val, hot);
+        if (x == NIL) return false;
+        Node& n = _nodes[x];
+        if (n.left != NIL && n.right != NIL) {
+            // 两个孩子：以后继（右子树最左节点）的数据替换，转而摘除后继
+            hot = x;
+            uint32_t s = n.right;
+            while (_nodes[s].left != NIL) {
+                hot = s;
+                s = _nodes[s].left;
+            }
+            n.data = _nodes[s].data;
+            x = s;
+        }
+        uint32_t child = (_nodes[x].left != NIL) ? _nodes[x].left : _nodes[x].right;
+        fromParentTo(hot, x) = child;
+        release(x);
+        _size--;
+        return true;
+    }
+
+    // 中序遍历（Morris，O(1)辅助空间）；访问器返回false时提前结束（仍走完全程以拆除线索）
+    template <typename VST>
+    bool inOrder(VST& visit) {
+        bool go = true;
+        uint32_t x = _root;
+        while (x != NIL) {
+            Node& n = _nodes[x];
+            if (n.left == NIL) {
+                if (go && !call(visit, n.data)) go = false;
+                x = n.right;
+                continue;
+            }
+            uint32_t p = n.left;
+            while (_nodes[p].right != NIL && _nodes[p].right != x) p = _nodes[p].right;
+            if (_nodes[p].right == NIL) {
+                _nodes[p].right = x;
+                x = n.left;
+            } else {
+                _nodes[p].right = NIL;
+                if (go && !call(visit, n.data)) go = false;
+                x = n.right;
+            }
+        }
+        return go;
+    }
+
+private:
+    template <typename VST>
+    static auto call(VST& visit, const T& e, int) -> decltype(bool(visit(e))) {
+        return visit(e);
+    }
+
+    template <typename VST>
+    static bool call(VST& visit, const T& e, long) {
+        visit(e);
+        return true;
+    }
+
+    template <typename VST>
+    static bool call(VST& visit, const T& e) {
+        return call(visit, e, 0);
+    }
+};
+
+#endif // COMPACT_BST_H
@@ -0,0 +1,196 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include "Stack.h"
+#include <cassert>
+#include <algorithm>
+
+// 分块双端队列
+// 元素存放在定长块中，块指针存放在块表（map）中，块表居中放置、向两端生长。
+// 扩容只重新分配块表，已有元素从不搬移；清空的块放入备用栈，供下次申请时复用。
+template <typename T>
+class Deque {
+private:
+    // 每块约 4KB，块大小取 2 的幂以便用移位和掩码定位
+    static constexpr int floorPow2(int n) { return n < 2 ? 1 : 2 * floorPow2(n / 2); }
+    static constexpr int BLOCK_SIZE = sizeof(T) >= 256 ? 16 : floorPow2(4096 / (int)sizeof(T));
+    static const int MAX_SPARE = 4;  // 备用块上限
+
+    T** _map;         // 块表
+    int _mapSize;     // 块表长度
+    int _start;       // 队头元素在块表中的绝对下标
+    int _size;        // 元素数量
+    Stack<T*> _spare; // 回收的空块
+
+    T* allocBlock() {
+        return _spare.empty() ? new T[BLOCK_SIZE] : _spare.pop();
+    }
+
+    void releaseBlock(int b) {
+        if (_spare.size() < MAX_SPARE) _spare.push(_map[b]);
+        else delete[] _map[b];
+        _map[b] = nullptr;
+    }
+
+    // 块表两端无空位时调用：已用块不足一半则原地居中，否则加倍后居中
+    void growMap() {
+        int first = _size ? _start / BLOCK_SIZE : 0;
+        int used = _size ? (_start + _size - 1) / BLOCK_SIZE - first + 1 : 0;
+        int newSize = (used * 2 < _mapSize) ? _mapSize : std::max(8, _mapSize * 2);
+        int newFirst = (newSize - used) / 2;
+
+        T** newMap = new T*[newSize];
+        for (int i = 0; i < newSize; ++i) newMap[i] = nullptr;
+        for (int i = 0; i < used; ++i) newMap[newFirst + i] = _map[first + i];
+        delete[] _map;
+
+        _map = newMap;
+        _mapSize = newSize;
+        _start = _size ? newFirst * BLOCK_SIZE + _start % BLOCK_SIZE : newSize / 2 * BLOCK_SIZE;
+    }
+
+    // 确保绝对下标 abs 所在的块已分配
+    T& slot(int abs) {
+        T*& block = _map[abs / BLOCK_SIZE];
+        if (!block) block = allocBlock();
+        return block[abs % BLOCK_SIZE];
+    }
+
+    // 队列清空后回收剩余块并重新居中
+    void reset() {
+        for (int i = 0; i < _mapSize; ++i)
+            if (_map[i]) releaseBlock(i);
+        _start = _mapSize / 2 * BLOCK_SIZE;
+    }
+
+public:
+    // 构造函数
+    Deque() : _map(nullptr), _mapSize(0), _start(0), _size(0) {}
+
+    // 拷贝构造函数
+    Deque(const Deque<T>& other) : _map(nullptr), _mapSize(0), _start(0), _size(0) {
+        for (int i = 0; i < other._size; ++i) push_back(other[i]);
+    }
+
+    // 析构函数
+    ~Deque() {
+        for (int i = 0; i < _mapSize; ++i) delete[] _map[i];
+        delete[] _map;
+        while (!_spare.empty()) delete[] _spare.pop();
+    }
+
+    // 赋值运算符
+    Deque<T>& operator=(const Deque<T>& other) {
+        if (this != &other) {
+            clear();
+            for (int i = 0; i < other._size; ++i) push_back(other[i]);
+        }
+        return *this;
+    }
+
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    // 随机访问，O(1)
+    T& operator[](int r) {
+        int abs = _start + r;
+        return _map[abs / BLOCK_SIZE][abs % BLOCK_SIZE];
+    }
+
+    const T& operator[](int r) const {
+        int abs = _start + r;
+        return _map[abs / BLOCK_SIZE][abs % BLOCK_SIZE];
+    }
+
+    // 队尾插入
+    void push_back(const T& e) {
+        if (_start + _size == _mapSize * BLOCK_SIZE) growMap();
+        slot(_start + _size) = e;
+        _size++;
+    }
+
+    // 队头插入
+    void push_front(const T& e) {
+        if (_start == 0) growMap();
+        slot(--_start) = e;
+        _size++;
+    }
+
+    // 队尾删除
+    T pop_back() {
+        assert(!empty() && "Deque is empty!");
+        int abs = _start + --_size;
+        T e = _map[abs / BLOCK_SIZE][abs % BLOCK_SIZE];
+        if (_size == 0) reset();
+        else if (abs % BLOCK_SIZE == 0) releaseBlock(abs / BLOCK_SIZE);
+        return e;
+    }
+
+    // 队头删除
+    T pop_front() {
+        assert(!empty() && "Deque is empty!");
+        int abs = _start++;
+        _size--;
+        T e = _map[abs / BLOCK_SIZE][abs % BLOCK_SIZE];
+        if (_size == 0) reset();
+        else if (_start % BLOCK_SIZE == 0) releaseBlock(abs / BLOCK_SIZE);
+        return e;
+    }
+
+    // 队头元素
+    T& front() {
+        assert(!empty() && "Deque is empty!");
+        return (*this)[0];
+    }
+
+    const T& front() const {
+        assert(!empty() && "Deque is empty!");
+        return (*this)[0];
+    }
+
+    // 队尾元素
+    T& back() {
+        assert(!empty() && "Deque is empty!");
+        return (*this)[_size - 1];
+    }
+
+    const T& back() const {
+        assert(!empty() && "Deque is empty!");
+        return (*this)[_size - 1];
+    }
+
+    // 清空队列（块进入备用栈，块表保留）
+    void clear() {
+        _size = 0;
+        reset();
+    }
+
+    // 遍历
+    template <typename VST>
+    void traverse(VST& visit) {
+        for (int i = 0; i < _size; ++i) visit((*this)[i]);
+    }
+
+    // 交换两个队列的内容
+    void swap(Deque<T>& other) {
+        std::swap(_map, other._map);
+        std::swap(_mapSize, other._mapSize);
+        std::swap(_start, other._start);
+        std::swap(_size, other._size);
+        _spare.swap(other._spare);
+    }
+
+    // 比较运算符
+    bool operator==(const Deque<T>& other) const {
+        if (_size != other._size) return false;
+        for (int i = 0; i < _size; ++i)
+            if ((*this)[i] != other[i]) return false;
+        return true;
+    }
+
+    bool operator!=(const Deque<T>& other) const {
+        return !(*this == other);
+    }
+};
+
+#endif // DEQUE_H
@@ -0,0 +1,126 @@
+#ifndef FROZEN_BST_H
+#define FROZEN_BST_H
+
+#include "Tree.h"
+#include <cstdint>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FROZEN_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define FROZEN_PREFETCH(p) ((void)0)
+#endif
+
+// 冻结的只读BST：关键码按Eytzinger（BFS）次序存入一个数组，下标k的孩子为2k、2k+1
+// 查找不追指针：每层只做一次比较并据此算出下一下标（无分支），同时预取若干层之后的缓存行
+// （以int为例，k往下第4层的16个后代16k..16k+15恰好占满一个缓存行），访存延迟得以重叠，
+// 树远大于末级缓存时仍可保持较高吞吐。
+// 由freeze(tree)自BST生成，O(n)；之后原树的修改不再反映到冻结副本中。
+template <typename T>
+class FrozenBST {
+private:
+    static const int LINE = 64;  // 缓存行字节数
+    static const int BLOCK = sizeof(T) < LINE ? LINE / (int)sizeof(T) : 1;  // 每个缓存行的关键码数
+
+    T* _buffer;  // 分配的存储（含对齐余量）
+    T* _a;       // _a[1, _size]为关键码，按缓存行对齐使得_a[k * BLOCK]起始于行首
+    int _size;
+
+    // 第一个大于（strict为false时为不小于）val的元素下标，不存在时为0
+    int firstAbove(const T& val, bool strict) const {
+        int k = 1;
+        if (strict) {
+            while (k <= _size) {
+                FROZEN_PREFETCH(_a + k * BLOCK);
+                k = 2 * k + !(val < _a[k]);
+            }
+        } else {
+            while (k <= _size) {
+                FROZEN_PREFETCH(_a + k * BLOCK);
+                k = 2 * k + (_a[k] < val);
+            }
+        }
+        // 最后一次向左转的节点即为所求：去掉末尾连续的1（向右转）以及其上的一个0
+        while (k & 1) k >>= 1;
+        return k >> 1;
+    }
+
+public:
+    FrozenBST() : _buffer(nullptr), _a(nullptr), _size(0) {}
+
+    // 按中序读出tree的关键码，填入Eytzinger次序，O(n)
+    explicit FrozenBST(const BST<T>& tree) : _buffer(nullptr), _a(nullptr), _size(tree.getSize()) {
+        if (_size == 0) return;
+        _buffer = new T[_size + 1 + BLOCK];
+        uintptr_t misalign = (uintptr_t)_buffer % LINE;
+        int shift = (LINE % sizeof(T) == 0 && misalign % sizeof(T) == 0) ? (int)((LINE - misalign) % LINE / sizeof(T)) : 0;
+        _a = _buffer + shift;
+        // 按中序走遍隐式树的下标：先到最左下标，之后依次转到中序后继
+        int k = 1;
+        while (2 * k <= _size) k *= 2;
+        for (typename BinaryTree<T>::iterator it = tree.begin(); it != tree.end(); ++it) {
+            _a[k] = *it;
+            if (2 * k + 1 <= _size) {  // 有右子树：后继为右子树的最左下标
+                k = 2 * k + 1;
+                while (2 * k <= _size) k *= 2;
+            } else {  // 否则向上越过所有右转，再上一层
+                while (k & 1) k >>= 1;
+                k >>= 1;
+            }
+        }
+    }
+
+    ~FrozenBST() {
+        delete[] _buffer;
+    }
+
+    FrozenBST(const FrozenBST&) = delete;
+    FrozenBST& operator=(const FrozenBST&) = delete;
+
+    FrozenBST(FrozenBST&& other) : _buffer(other._buffer), _a(other._a), _size(other._size) {
+        other._buffer = other._a = nullptr;
+        other._size = 0;
+    }
+
+    FrozenBST& operator=(FrozenBST&& other) {
+        if (this != &other) {
+            delete[] _buffer;
+            _buffer = other._buffer;
+            _a = other._a;
+            _size = other._size;
+            other._buffer = other._a = nullptr;
+            other._size = 0;
+        }
+        return *this;
+    }
+
+    bool empty() const { return _size == 0; }
+    int getSize() const { return _size; }
+
+    // 查找元素，不存在时返回nullptr
+    const T* search(const T& val) const {
+        int k = firstAbove(val, false);
+        return (k && !(val < _a[k])) ? &_a[k] : nullptr;
+    }
+
+    // 第一个不小于val的元素，不存在时返回nullptr
+    const T* lower_bound(const T& val) const {
+        int k = firstAbove(val, false);
+        return k ? &_a[k] : nullptr;
+    }
+
+    // 第一个大于val的元素，不存在时返回nullptr
+    const T* upper_bound(const T& val) const {
+        int k = firstAbove(val, true);
+        return k ? &_a[k] : nullptr;
+    }
+};
+
+// 把BST冻结为只读的Eytzinger数组，用于加载完毕后只查不改的场景
+template <typename T>
+FrozenBST<T> freeze(const BST<T>& tree) {
+    return FrozenBST<T>(tree);
+}
+
+#undef FROZEN_PREFETCH
+
+#endif // FROZEN_BST_H
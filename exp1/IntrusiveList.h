@@ -0,0 +1,168 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <cassert>
+
+// 挂钩模式
+enum HookMode {
+    SAFE_LINK,   // 摘下后指针置空，可检测重复插入；对象析构时必须已不在列表中
+    AUTO_UNLINK  // 对象析构时自动从所在列表中摘下（列表规模需遍历统计）
+};
+
+struct DefaultHookTag {};
+
+// 侵入式链表挂钩：作为基类嵌入用户对象，Tag 用于区分同一对象挂在多个列表上的不同挂钩
+template <typename Tag = DefaultHookTag, HookMode Mode = SAFE_LINK>
+class IntrusiveListHook {
+public:
+    IntrusiveListHook* prev;
+    IntrusiveListHook* next;
+
+    IntrusiveListHook() : prev(nullptr), next(nullptr) {}
+
+    // 复制对象时不复制其在列表中的位置
+    IntrusiveListHook(const IntrusiveListHook&) : prev(nullptr), next(nullptr) {}
+    IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+    ~IntrusiveListHook() {
+        if (Mode == AUTO_UNLINK) unlink();
+        else assert(!isLinked() && "object destroyed while still in an IntrusiveList!");
+    }
+
+    bool isLinked() const { return next != nullptr; }
+
+    // 从所在列表中摘下，O(1)
+    void unlink() {
+        if (!isLinked()) return;
+        prev->next = next;
+        next->prev = prev;
+        prev = next = nullptr;
+    }
+};
+
+// 侵入式双向链表：节点就是用户对象本身，插入、删除不申请内存、不复制数据
+// T 须以 IntrusiveListHook<Tag, Mode> 为基类；列表不拥有对象，clear 与析构只摘链不释放。
+template <typename T, typename Tag = DefaultHookTag, HookMode Mode = SAFE_LINK>
+class IntrusiveList {
+private:
+    typedef IntrusiveListHook<Tag, Mode> Hook;
+
+    Hook header;  // 环形哨兵：header.next 为首元素，header.prev 为末元素
+    int _size;    // 规模（AUTO_UNLINK 模式下不维护）
+
+    static T* object(Hook* h) { return static_cast<T*>(h); }
+    static Hook* hook(T& x) { return static_cast<Hook*>(&x); }
+
+    // 把 x 接在 pos 之前
+    void link(Hook* pos, Hook* x) {
+        assert(!x->isLinked() && "object already in a list!");
+        x->prev = pos->prev;
+        x->next = pos;
+        pos->prev->next = x;
+        pos->prev = x;
+        _size++;
+    }
+
+public:
+    // 构造函数
+    IntrusiveList() : _size(0) {
+        header.prev = header.next = &header;
+    }
+
+    // 析构函数：摘下全部对象
+    ~IntrusiveList() {
+        clear();
+        header.prev = header.next = nullptr;
+    }
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    // 只读访问接口
+    bool empty() const { return header.next == &header; }
+    int size() const {
+        if (Mode == SAFE_LINK) return _size;
+        int n = 0;
+        for (const Hook* h = header.next; h != &header; h = h->next) n++;
+        return n;
+    }
+    T* first() const { return empty() ? nullptr : object(header.next); }
+    T* last() const { return empty() ? nullptr : object(header.prev); }
+    T* next(T& x) const {
+        Hook* h = hook(x)->next;
+        return h == &header ? nullptr : object(h);
+    }
+    T* prev(T& x) const {
+        Hook* h = hook(x)->prev;
+        return h == &header ? nullptr : object(h);
+    }
+
+    // 插入，O(1)
+    void insertAsFirst(T& x) { link(header.next, hook(x)); }
+    void insertAsLast(T& x) { link(&header, hook(x)); }
+    void insertBefore(T& pos, T& x) { link(hook(pos), hook(x)); }
+    void insertAfter(T& pos, T& x) { link(hook(pos)->next, hook(x)); }
+
+    // 删除（仅摘链，不释放对象），O(1)
+    T& remove(T& x) {
+        assert(hook(x)->isLinked());
+        hook(x)->unlink();
+        _size--;
+        return x;
+    }
+
+    T* popFirst() {
+        T* x = first();
+        if (x) remove(*x);
+        return x;
+    }
+
+    T* popLast() {
+        T* x = last();
+        if (x) remove(*x);
+        return x;
+    }
+
+    // 摘下全部对象
+    void clear() {
+        Hook* h = header.next;
+        while (h != &header) {
+            Hook* next = h->next;
+            h->prev = h->next = nullptr;
+            h = next;
+        }
+        header.prev = header.next = &header;
+        _size = 0;
+    }
+
+    // 遍历（与 List::traverse 相同的访问器形式）
+    void traverse(void (*visit)(T&)) {
+        for (Hook* h = header.next; h != &header; h = h->next)
+            visit(*object(h));
+    }
+
+    template <typename VST>
+    void traverse(VST& visit) {
+        for (Hook* h = header.next; h != &header; h = h->next)
+            visit(*object(h));
+    }
+
+    // 前向迭代器
+    class iterator {
+    private:
+        Hook* _h;
+    public:
+        iterator(Hook* h) : _h(h) {}
+        T& operator*() const { return *object(_h); }
+        T* operator->() const { return object(_h); }
+        iterator& operator++() { _h = _h->next; return *this; }
+        iterator& operator--() { _h = _h->prev; return *this; }
+        bool operator==(const iterator& o) const { return _h == o._h; }
+        bool operator!=(const iterator& o) const { return _h != o._h; }
+    };
+
+    iterator begin() { return iterator(header.next); }
+    iterator end() { return iterator(&header); }
+};
+
+#endif // INTRUSIVE_LIST_H
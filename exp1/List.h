@@ -3,6 +3,8 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <type_traits>
+#include "NodePool.h"
 using namespace std;
 
 template <typename T>
@@ -16,16 +18,18 @@ struct ListNode {
     ListNode(T e, ListNode<T>* p = nullptr, ListNode<T>* n = nullptr)
         : data(e), prev(p), next(n) {}
     
-    // 插入节点
-    ListNode<T>* insertAsPrev(const T& e) {
-        ListNode<T>* node = new ListNode<T>(e, prev, this);
+    // 插入节点（节点从pool中分配）
+    // 注意：与旧版的insertAsPrev(e)/insertAsNext(e)不兼容，旧版以new分配，所得节点无法归还节点池，故已移除；
+    // pool须为节点所在列表的节点池（List::pool()），列表外部请改用List::insertBefore/insertAfter
+    ListNode<T>* insertAsPrev(const T& e, NodePool<ListNode<T> >& pool) {
+        ListNode<T>* node = pool.create(e, prev, this);
         prev->next = node;
         prev = node;
         return node;
     }
     
-    ListNode<T>* insertAsNext(const T& e) {
-        ListNode<T>* node = new ListNode<T>(e, this, next);
+    ListNode<T>* insertAsNext(const T& e, NodePool<ListNode<T> >& pool) {
+        ListNode<T>* node = pool.create(e, this, next);
         next->prev = node;
         next = node;
         return node;
@@ -38,8 +42,16 @@ private:
     int _size;           // 规模
     ListNode<T>* header; // 头哨兵
     ListNode<T>* trailer;// 尾哨兵
+    NodePool<ListNode<T> >* _pool; // 节点池（引用计数，可与其他列表共享）
 
 protected:
+    // 初始化：创建哨兵；pool为空时使用独占节点池
+    void init(NodePool<ListNode<T> >* pool = nullptr);
+    // 节点池是否仅被本列表使用
+    bool exclusivePool() const { return _pool->refs() == 1; }
+    // 把other中的节点x移到pos之前，返回它在本表中的节点：节点池相同时直接重新链接（仍为x），
+    // 否则复制数据到本表的节点池后从other中删除x
+    ListNode<T>* transfer(ListNode<T>* pos, List<T>& other, ListNode<T>* x);
     // 清除所有节点
     void clear();
     // 复制列表L中自位置p起的n个元素
@@ -48,10 +60,17 @@ protected:
     void selectionSort(ListNode<T>* p, int n);
     // 插入排序
     void insertionSort(ListNode<T>* p, int n);
+    // 归并排序（自然归并，重新链接节点）
+    void mergeSort(ListNode<T>* p, int n);
+    // 从单链 rest 头部切下一个非降序段，返回段首，tail 为段尾
+    static ListNode<T>* cutRun(ListNode<T>*& rest, ListNode<T>*& tail);
+    // 稳定归并两个以 nullptr 结尾的有序单链，返回新链首，tail 为新链尾
+    static ListNode<T>* mergeRuns(ListNode<T>* a, ListNode<T>* b, ListNode<T>*& tail);
 
 public:
     // 构造函数
     List();
+    List(NodePool<ListNode<T> >& pool); // 与其他列表共享节点池
     List(const List<T>& L);
     List(const List<T>& L, int r, int n);
     List(ListNode<T>* p, int n);
@@ -75,6 +94,12 @@ public:
     }
     ListNode<T>* find(const T& e, int n, ListNode<T>* p) const;
     
+    // 有序列表查找：在p的n个前驱中找到不大于e的最后者
+    ListNode<T>* search(const T& e) const {
+        return search(e, _size, trailer);
+    }
+    ListNode<T>* search(const T& e, int n, ListNode<T>* p) const;
+    
     // 插入
     ListNode<T>* insertAsFirst(const T& e);
     ListNode<T>* insertAsLast(const T& e);
@@ -95,16 +120,52 @@ public:
     // 排序
     void sort(ListNode<T>* p, int n);
     void sort() { sort(first(), _size); }
+    
+    // 按遍历顺序把节点重排到连续内存；此前取得的ListNode*全部失效
+    void compact();
+    
+    // 节点池：构造新列表时传入，即可与本列表共享节点池
+    NodePool<ListNode<T> >& pool() const { return *_pool; }
+    
+    // 拼接：把other中的节点移到pos之前
+    // 两表共享节点池（如 List<T> b(a.pool())）时只修改指针，O(1)，节点及指向它们的指针保持有效；
+    // 否则逐个复制到本表的节点池并释放原节点，O(k)，指向被移动节点的指针随之失效。
+    // 共享节点池的列表须在同一线程中使用（节点池不加锁）。
+    void splice(ListNode<T>* pos, List<T>& other);
+    ListNode<T>* splice(ListNode<T>* pos, List<T>& other, ListNode<T>* x);
+    void splice(ListNode<T>* pos, List<T>& other, ListNode<T>* first, ListNode<T>* last, int n);
+    // 分割：保留前r个节点，其余节点移到out末尾
+    void split_at(int r, List<T>& out);
+    // 归并：两表均有序，把other的节点稳定地归并进本表（共享节点池时不申请新节点）
+    void merge(List<T>& other);
+    // 稳定划分：满足pred的节点移到前部，返回第一个不满足pred的节点
+    template <typename Pred> ListNode<T>* partition(Pred pred);
+    // 把不满足pred的节点按原顺序移到out末尾，返回移动的节点数
+    template <typename Pred> int partition(Pred pred, List<T>& out);
 };
 
-// 构造函数实现
+// 初始化
 template <typename T>
-List<T>::List() {
+void List<T>::init(NodePool<ListNode<T> >* pool) {
     _size = 0;
     header = new ListNode<T>();
     trailer = new ListNode<T>();
     header->next = trailer;
     trailer->prev = header;
+    if (pool) pool->retain();
+    else pool = new NodePool<ListNode<T> >();
+    _pool = pool;
+}
+
+// 构造函数实现
+template <typename T>
+List<T>::List() {
+    init();
+}
+
+template <typename T>
+List<T>::List(NodePool<ListNode<T> >& pool) {
+    init(&pool);
 }
 
 template <typename T>
@@ -130,16 +191,13 @@ List<T>::~List() {
     clear();
     delete header;
     delete trailer;
+    _pool->release();
 }
 
 // 复制节点
 template <typename T>
 void List<T>::copyNodes(ListNode<T>* p, int n) {
-    header = new ListNode<T>();
-    trailer = new ListNode<T>();
-    header->next = trailer;
-    trailer->prev = header;
-    _size = 0;
+    init();
     
     for (int i = 0; i < n; i++) {
         insertAsLast(p->data);
@@ -150,11 +208,15 @@ void List<T>::copyNodes(ListNode<T>* p, int n) {
 // 清除所有节点
 template <typename T>
 void List<T>::clear() {
-    ListNode<T>* p = header->next;
-    while (p != trailer) {
-        ListNode<T>* temp = p;
-        p = p->next;
-        delete temp;
+    if (exclusivePool() && std::is_trivially_destructible<T>::value) {
+        _pool->releaseAll();  // 独占节点池且无需析构：整块释放
+    } else {
+        ListNode<T>* p = header->next;
+        while (p != trailer) {
+            ListNode<T>* temp = p;
+            p = p->next;
+            _pool->destroy(temp);
+        }
     }
     header->next = trailer;
     trailer->prev = header;
@@ -179,29 +241,39 @@ ListNode<T>* List<T>::find(const T& e, int n, ListNode<T>* p) const {
     return nullptr;
 }
 
+// 有序列表查找
+template <typename T>
+ListNode<T>* List<T>::search(const T& e, int n, ListNode<T>* p) const {
+    while (n-- >= 0) {
+        p = p->prev;
+        if (p == header || !(e < p->data)) break;
+    }
+    return p;
+}
+
 // 插入操作
 template <typename T>
 ListNode<T>* List<T>::insertAsFirst(const T& e) {
     _size++;
-    return header->insertAsNext(e);
+    return header->insertAsNext(e, *_pool);
 }
 
 template <typename T>
 ListNode<T>* List<T>::insertAsLast(const T& e) {
     _size++;
-    return trailer->insertAsPrev(e);
+    return trailer->insertAsPrev(e, *_pool);
 }
 
 template <typename T>
 ListNode<T>* List<T>::insertBefore(ListNode<T>* p, const T& e) {
     _size++;
-    return p->insertAsPrev(e);
+    return p->insertAsPrev(e, *_pool);
 }
 
 template <typename T>
 ListNode<T>* List<T>::insertAfter(ListNode<T>* p, const T& e) {
     _size++;
-    return p->insertAsNext(e);
+    return p->insertAsNext(e, *_pool);
 }
 
 // 删除操作
@@ -210,7 +282,7 @@ T List<T>::remove(ListNode<T>* p) {
     T e = p->data;
     p->prev->next = p->next;
     p->next->prev = p->prev;
-    delete p;
+    _pool->destroy(p);
     _size--;
     return e;
 }
@@ -304,17 +376,248 @@ void List<T>::selectionSort(ListNode<T>* p, int n) {
 template <typename T>
 void List<T>::insertionSort(ListNode<T>* p, int n) {
     for (int i = 0; i < n; i++) {
-        insertBefore(search(p->data, i, p), p->data);
+        insertAfter(search(p->data, i, p), p->data);
         p = p->next;
         remove(p->prev);
     }
 }
 
+// 切下一个非降序段
+template <typename T>
+ListNode<T>* List<T>::cutRun(ListNode<T>*& rest, ListNode<T>*& tail) {
+    ListNode<T>* head = rest;
+    tail = head;
+    while (tail->next && !(tail->next->data < tail->data))
+        tail = tail->next;
+    rest = tail->next;
+    tail->next = nullptr;
+    return head;
+}
+
+// 归并两个有序段（相等时取前段元素，保证稳定）
+template <typename T>
+ListNode<T>* List<T>::mergeRuns(ListNode<T>* a, ListNode<T>* b, ListNode<T>*& tail) {
+    ListNode<T> dummy;
+    tail = &dummy;
+    while (a && b) {
+        if (b->data < a->data) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a ? a : b;
+    while (tail->next) tail = tail->next;
+    return dummy.next;
+}
+
+// 归并排序：对起始于p的n个节点做自底向上的自然归并
+// 排序期间只维护next指针，按非降序段两两归并，已有序的输入一趟即可结束；
+// 全程只修改指针，不复制数据、不申请内存，最后一趟顺序修复prev指针
+template <typename T>
+void List<T>::mergeSort(ListNode<T>* p, int n) {
+    if (n < 2) return;
+    ListNode<T>* head = p->prev;
+    ListNode<T>* tail = p;
+    for (int i = 0; i < n; i++) tail = tail->next;
+    tail->prev->next = nullptr;  // 断开为以nullptr结尾的单链
+
+    ListNode<T>* list = p;
+    for (;;) {
+        ListNode<T>* merged = nullptr;
+        ListNode<T>* mergedTail = nullptr;
+        int runs = 0;
+        while (list) {
+            ListNode<T>* last;
+            ListNode<T>* run = cutRun(list, last);
+            if (list) {
+                ListNode<T>* lastB;
+                ListNode<T>* runB = cutRun(list, lastB);
+                run = mergeRuns(run, runB, last);
+            }
+            if (mergedTail) mergedTail->next = run;
+            else merged = run;
+            mergedTail = last;
+            runs++;
+        }
+        list = merged;
+        if (runs == 1) break;
+    }
+
+    // 修复prev指针并接回原位
+    ListNode<T>* prev = head;
+    for (ListNode<T>* q = list; q; q = q->next) {
+        prev->next = q;
+        q->prev = prev;
+        prev = q;
+    }
+    prev->next = tail;
+    tail->prev = prev;
+}
+
 // 排序接口
 template <typename T>
 void List<T>::sort(ListNode<T>* p, int n) {
-    // 使用选择排序替代归并排序，避免潜在问题
-    selectionSort(p, n);
+    mergeSort(p, n);
+}
+
+// 紧凑化：预留一段连续节点，按遍历顺序复制数据并重新链接，再释放旧节点
+// 独占节点池时改用新池，旧池连同其中的碎片整体释放
+// 数据被复制到新节点，调用前取得的ListNode*（如first()、insertAsLast的返回值）一律失效，须重新获取
+template <typename T>
+void List<T>::compact() {
+    if (_size == 0) return;
+    bool exclusive = exclusivePool();
+    NodePool<ListNode<T> >* pool = exclusive ? new NodePool<ListNode<T> >() : _pool;
+    pool->reserve(_size);
+    
+    ListNode<T>* old = header->next;
+    ListNode<T>* prev = header;
+    for (ListNode<T>* p = old; p != trailer; p = p->next) {
+        ListNode<T>* node = pool->create(p->data, prev, trailer);
+        prev->next = node;
+        prev = node;
+    }
+    trailer->prev = prev;
+    
+    // 旧节点之间的next指针仍然完好，可以沿原链释放
+    while (old != trailer) {
+        ListNode<T>* temp = old;
+        old = old->next;
+        _pool->destroy(temp);
+    }
+    if (exclusive) {
+        _pool->release();
+        _pool = pool;
+    }
+}
+
+// 移动单个节点
+template <typename T>
+ListNode<T>* List<T>::transfer(ListNode<T>* pos, List<T>& other, ListNode<T>* x) {
+    if (_pool != other._pool) {  // 节点不能归还到别的节点池，只能复制
+        ListNode<T>* node = insertBefore(pos, x->data);
+        other.remove(x);
+        return node;
+    }
+    x->prev->next = x->next;
+    x->next->prev = x->prev;
+    other._size--;
+    x->prev = pos->prev;
+    x->next = pos;
+    pos->prev->next = x;
+    pos->prev = x;
+    _size++;
+    return x;
+}
+
+// 拼接整个列表
+template <typename T>
+void List<T>::splice(ListNode<T>* pos, List<T>& other) {
+    if (&other == this || other._size == 0) return;
+    splice(pos, other, other.first(), other.last(), other._size);
+}
+
+// 拼接单个节点
+template <typename T>
+ListNode<T>* List<T>::splice(ListNode<T>* pos, List<T>& other, ListNode<T>* x) {
+    if (x == pos || x->next == pos) return x;
+    return transfer(pos, other, x);
+}
+
+// 拼接区间[first, last]，共n个节点（pos不得位于区间内）
+template <typename T>
+void List<T>::splice(ListNode<T>* pos, List<T>& other, ListNode<T>* first, ListNode<T>* last, int n) {
+    if (n <= 0) return;
+    if (_pool != other._pool) {
+        for (int i = 0; i < n; i++) {
+            ListNode<T>* next = first->next;
+            transfer(pos, other, first);
+            first = next;
+        }
+        return;
+    }
+    // 从原表摘下
+    first->prev->next = last->next;
+    last->next->prev = first->prev;
+    other._size -= n;
+    // 接到pos之前
+    first->prev = pos->prev;
+    last->next = pos;
+    pos->prev->next = first;
+    pos->prev = last;
+    _size += n;
+}
+
+// 分割：从较近的一端走到秩r处
+template <typename T>
+void List<T>::split_at(int r, List<T>& out) {
+    if (r < 0) r = 0;
+    if (r >= _size) return;
+    ListNode<T>* p;
+    if (r <= _size - r) {
+        p = first();
+        for (int i = 0; i < r; i++) p = p->next;
+    } else {
+        p = trailer;
+        for (int i = _size; i > r; i--) p = p->prev;
+    }
+    out.splice(out.trailer, *this, p, last(), _size - r);
+}
+
+// 有序归并：other中与本表相等的元素排在本表元素之后，保证稳定
+template <typename T>
+void List<T>::merge(List<T>& other) {
+    if (&other == this) return;
+    ListNode<T>* p = first();
+    ListNode<T>* q = other.first();
+    while (q != other.trailer) {
+        while (p != trailer && !(q->data < p->data)) p = p->next;
+        if (p == trailer) {  // 剩余部分整体接到末尾
+            splice(trailer, other, q, other.last(), other._size);
+            return;
+        }
+        ListNode<T>* next = q->next;
+        transfer(p, other, q);
+        q = next;
+    }
+}
+
+// 稳定划分
+template <typename T>
+template <typename Pred>
+ListNode<T>* List<T>::partition(Pred pred) {
+    ListNode<T>* mark = header;  // 已就位的最后一个满足pred的节点
+    ListNode<T>* p = first();
+    while (p != trailer) {
+        ListNode<T>* next = p->next;
+        if (pred(p->data)) {
+            if (p->prev != mark) transfer(mark->next, *this, p);
+            mark = p;
+        }
+        p = next;
+    }
+    return mark->next;
+}
+
+// 划分到另一列表
+template <typename T>
+template <typename Pred>
+int List<T>::partition(Pred pred, List<T>& out) {
+    int moved = 0;
+    ListNode<T>* p = first();
+    while (p != trailer) {
+        ListNode<T>* next = p->next;
+        if (!pred(p->data)) {
+            out.transfer(out.trailer, *this, p);
+            moved++;
+        }
+        p = next;
+    }
+    return moved;
 }
 
 #endif // LIST_H
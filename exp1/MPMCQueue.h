@@ -0,0 +1,190 @@
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <cassert>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+
+// 有界多生产者/多消费者队列（Vyukov 算法）
+// 每个槽位带一个序号：序号 == 入队位置 表示可写，序号 == 位置 + 1 表示可读。
+// 生产者与消费者各自只竞争一个位置计数器，不加锁，也不会在运行中扩容。
+template <typename T>
+class MPMCQueue {
+private:
+    static const size_t CACHE_LINE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;  // 槽位序号
+        T data;                        // 槽位数据
+    };
+
+    Cell* _buffer;       // 环形缓冲区
+    size_t _mask;        // 容量 - 1（容量为 2 的幂）
+
+    // 两个位置计数器分占不同缓存行，避免生产者与消费者之间的伪共享
+    alignas(CACHE_LINE) std::atomic<size_t> _enqueuePos;
+    alignas(CACHE_LINE) std::atomic<size_t> _dequeuePos;
+
+    // 向上取整到 2 的幂
+    static size_t roundUp(size_t n) {
+        size_t cap = 2;
+        while (cap < n) cap <<= 1;
+        return cap;
+    }
+
+    // 在 pos 处尝试占用至多 n 个连续槽位，返回实际占用数量（0 表示失败）
+    // offset：槽位序号 == 位置 + offset 时就绪，生产者传入 0，消费者传入 1
+    size_t claim(std::atomic<size_t>& counter, size_t n, size_t offset, size_t& pos) {
+        pos = counter.load(std::memory_order_relaxed);
+        for (;;) {
+            size_t k = 0;
+            while (k < n) {
+                size_t seq = _buffer[(pos + k) & _mask].sequence.load(std::memory_order_acquire);
+                if (seq != pos + k + offset) break;
+                ++k;
+            }
+            if (k == 0) {
+                size_t seq = _buffer[pos & _mask].sequence.load(std::memory_order_acquire);
+                intptr_t diff = (intptr_t)seq - (intptr_t)(pos + offset);
+                if (diff < 0) return 0;  // 满（生产者）或空（消费者）
+                pos = counter.load(std::memory_order_relaxed);  // 被其他线程抢先，重读
+                continue;
+            }
+            if (counter.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed))
+                return k;
+        }
+    }
+
+    // 退避：先自旋，再让出时间片
+    static void backoff(int& spins) {
+        if (++spins < 64) return;
+        std::this_thread::yield();
+    }
+
+public:
+    // 构造函数，容量向上取整到 2 的幂
+    MPMCQueue(size_t capacity = 1024) {
+        size_t cap = roundUp(capacity);
+        _buffer = new Cell[cap];
+        _mask = cap - 1;
+        for (size_t i = 0; i < cap; ++i)
+            _buffer[i].sequence.store(i, std::memory_order_relaxed);
+        _enqueuePos.store(0, std::memory_order_relaxed);
+        _dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    // 析构函数
+    ~MPMCQueue() {
+        delete[] _buffer;
+    }
+
+    // 禁止拷贝（槽位序号与在途线程无法一并复制）
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    // 尝试入队，队满时立即返回 false
+    bool try_enqueue(const T& e) {
+        size_t pos;
+        if (!claim(_enqueuePos, 1, 0, pos)) return false;
+        Cell& cell = _buffer[pos & _mask];
+        cell.data = e;
+        cell.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 尝试出队，队空时立即返回 false
+    bool try_dequeue(T& e) {
+        size_t pos;
+        if (!claim(_dequeuePos, 1, 1, pos)) return false;
+        Cell& cell = _buffer[pos & _mask];
+        e = cell.data;
+        cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 批量入队：一次 CAS 占用多个连续槽位，返回实际入队数量
+    int try_enqueue_bulk(const T* items, int n) {
+        assert(n >= 0);
+        size_t pos;
+        size_t k = claim(_enqueuePos, (size_t)n, 0, pos);
+        for (size_t i = 0; i < k; ++i) {
+            Cell& cell = _buffer[(pos + i) & _mask];
+            cell.data = items[i];
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return (int)k;
+    }
+
+    // 批量出队：一次 CAS 占用多个连续槽位，返回实际出队数量
+    int try_dequeue_bulk(T* out, int n) {
+        assert(n >= 0);
+        size_t pos;
+        size_t k = claim(_dequeuePos, (size_t)n, 1, pos);
+        for (size_t i = 0; i < k; ++i) {
+            Cell& cell = _buffer[(pos + i) & _mask];
+            out[i] = cell.data;
+            cell.sequence.store(pos + i + _mask + 1, std::memory_order_release);
+        }
+        return (int)k;
+    }
+
+    // 阻塞入队，直到成功
+    void enqueue(const T& e) {
+        int spins = 0;
+        while (!try_enqueue(e)) backoff(spins);
+    }
+
+    // 阻塞出队，直到成功
+    T dequeue() {
+        T e;
+        int spins = 0;
+        while (!try_dequeue(e)) backoff(spins);
+        return e;
+    }
+
+    // 限时入队，超时返回 false
+    template <typename Rep, typename Period>
+    bool enqueue_for(const T& e, const std::chrono::duration<Rep, Period>& timeout) {
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+        int spins = 0;
+        while (!try_enqueue(e)) {
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            backoff(spins);
+        }
+        return true;
+    }
+
+    // 限时出队，超时返回 false
+    template <typename Rep, typename Period>
+    bool dequeue_for(T& e, const std::chrono::duration<Rep, Period>& timeout) {
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+        int spins = 0;
+        while (!try_dequeue(e)) {
+            if (std::chrono::steady_clock::now() >= deadline) return false;
+            backoff(spins);
+        }
+        return true;
+    }
+
+    // 队列容量
+    int capacity() const {
+        return (int)(_mask + 1);
+    }
+
+    // 近似元素数量（并发修改时仅供参考）
+    int size() const {
+        size_t head = _dequeuePos.load(std::memory_order_relaxed);
+        size_t tail = _enqueuePos.load(std::memory_order_relaxed);
+        return tail > head ? (int)(tail - head) : 0;
+    }
+
+    // 判断队列是否为空（并发修改时仅供参考）
+    bool empty() const {
+        return size() == 0;
+    }
+};
+
+#endif // MPMC_QUEUE_H
@@ -0,0 +1,128 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cassert>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+// 节点池：按块（slab）批量申请节点内存，空闲节点串成自由链表
+// create/destroy 均为 O(1) 且不经过 malloc；同一块内的节点地址连续，遍历时缓存友好。
+// 块大小从 initial 起倍增，至多 MAX_SLAB 个节点。
+// 节点池带引用计数，可由多个容器共享：创建者持有初始引用，计数归零时由 release 删除。
+template <typename N>
+class NodePool {
+private:
+    static const int MAX_SLAB = 4096;
+
+    // 空闲时存放自由链表指针，使用时存放节点本身
+    union Slot {
+        Slot* next;
+        typename std::aligned_storage<sizeof(N), alignof(N)>::type storage;
+    };
+
+    struct Slab {
+        Slab* next;   // 下一块
+        Slot* slots;  // 本块节点数组
+    };
+
+    Slot* _free;        // 自由链表
+    Slab* _slabs;       // 已申请的块
+    int _nextSlabSize;  // 下一块的节点数
+    int _live;          // 使用中的节点数
+    int _refs;          // 引用计数
+
+    // 新增一块，按地址升序挂到自由链表头部，使接下来的 n 次 create 依次返回相邻地址
+    void addSlab(int n) {
+        Slab* slab = new Slab;
+        slab->slots = new Slot[n];
+        slab->next = _slabs;
+        _slabs = slab;
+        for (int i = n - 1; i >= 0; --i) {
+            slab->slots[i].next = _free;
+            _free = &slab->slots[i];
+        }
+    }
+
+public:
+    NodePool(int initial = 64) : _free(nullptr), _slabs(nullptr), _nextSlabSize(initial > 0 ? initial : 64), _live(0), _refs(1) {}
+
+    // 析构函数：释放所有块（不调用仍在使用的节点的析构函数）
+    ~NodePool() {
+        releaseAll();
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // 构造一个节点
+    template <typename... Args>
+    N* create(Args&&... args) {
+        if (!_free) {
+            addSlab(_nextSlabSize);
+            if (_nextSlabSize < MAX_SLAB) _nextSlabSize *= 2;
+        }
+        Slot* s = _free;
+        _free = s->next;
+        _live++;
+        return new (&s->storage) N(std::forward<Args>(args)...);
+    }
+
+    // 析构节点并归还到自由链表
+    void destroy(N* node) {
+        node->~N();
+        Slot* s = reinterpret_cast<Slot*>(node);
+        s->next = _free;
+        _free = s;
+        _live--;
+    }
+
+    // 预留 n 个地址连续的节点：接下来的 n 次 create 按地址升序返回
+    void reserve(int n) {
+        if (n > 0) addSlab(n);
+    }
+
+    // 一次性释放全部块，O(块数)；不调用节点析构函数，仅适用于节点已析构或可平凡析构的场合
+    void releaseAll() {
+        while (_slabs) {
+            Slab* s = _slabs;
+            _slabs = s->next;
+            delete[] s->slots;
+            delete s;
+        }
+        _free = nullptr;
+        _live = 0;
+    }
+
+    // 接管另一个节点池的全部块与空闲节点（其中的节点归本池所有），other 随后为空，O(other 的空闲节点数)
+    void adopt(NodePool& other) {
+        if (other._free) {
+            Slot* tail = other._free;
+            while (tail->next) tail = tail->next;
+            tail->next = _free;
+            _free = other._free;
+        }
+        if (other._slabs) {
+            Slab* tail = other._slabs;
+            while (tail->next) tail = tail->next;
+            tail->next = _slabs;
+            _slabs = other._slabs;
+        }
+        _live += other._live;
+        other._free = nullptr;
+        other._slabs = nullptr;
+        other._live = 0;
+    }
+
+    // 使用中的节点数
+    int live() const { return _live; }
+
+    // 引用计数：容器共享节点池时 retain，不再使用时 release（仅适用于 new 出的节点池）
+    void retain() { ++_refs; }
+    void release() {
+        if (--_refs == 0) delete this;
+    }
+    int refs() const { return _refs; }
+};
+
+#endif // NODE_POOL_H
@@ -0,0 +1,246 @@
+#ifndef PARALLEL_TREE_H
+#define PARALLEL_TREE_H
+
+#include "Tree.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+
+// 二叉树的 fork/join 并行操作
+// 各任务沿较大的孩子向下走，把较小的孩子（规模大于 cutoff 时）派生为新任务；
+// 规模不超过 cutoff 的子树交给顺序算法处理。借助节点中的子树规模，划分只需 O(1) 判断；
+// 退化为长链的树不会产生深递归，只是并行度降为 1。
+template <typename T>
+class ParallelTree {
+private:
+    typedef TreeNode<T> Node;
+    typedef NodePool<Node> Pool;
+    typedef BinaryTree<T> Tree;
+
+    // 归约的部分结果：rank 为该段首元素的中序秩，合并时按秩排序以保持次序
+    template <typename R>
+    struct Segment {
+        int rank;
+        R value;
+        bool operator<(const Segment& o) const { return rank < o.rank; }
+        bool operator<=(const Segment& o) const { return rank <= o.rank; }
+    };
+
+    static bool leftBigger(const Node* x) {
+        return Tree::sizeOf(x->left) >= Tree::sizeOf(x->right);
+    }
+
+    // 复制单个节点（含高度、子树规模及增广值），孩子留空
+    static Node* clone(const Node* src, Node* parent, Pool& pool) {
+        Node* x = pool.create(src->data, parent);
+        x->height = src->height;
+        x->size = src->size;
+        static_cast<typename TreeAugment<T>::value&>(*x) = static_cast<const typename TreeAugment<T>::value&>(*src);
+        return x;
+    }
+
+    // 把 src 子树复制到 *slot；每个任务使用独立的节点池，结束后登记到 pools
+    static void copyTask(const Node* src, Node* parent, Node** slot, int cutoff, TaskGroup& group,
+                         std::mutex& lock, Vector<Pool*>& pools) {
+        Pool* pool = new Pool();
+        while (src && src->size > cutoff) {
+            Node* x = clone(src, parent, *pool);
+            *slot = x;
+            bool lb = leftBigger(src);
+            const Node* small = lb ? src->right : src->left;
+            Node** smallSlot = lb ? &x->right : &x->left;
+            if (small)
+                group.spawn([small, x, smallSlot, cutoff, &group, &lock, &pools]() {
+                    copyTask(small, x, smallSlot, cutoff, group, lock, pools);
+                });
+            slot = lb ? &x->left : &x->right;
+            src = lb ? src->left : src->right;
+            parent = x;
+        }
+        pool->reserve(Tree::sizeOf(src));  // 顺序部分的节点连续存放
+        *slot = Tree::copy(src, parent, *pool);
+        std::lock_guard<std::mutex> guard(lock);
+        pools.push_back(pool);
+    }
+
+    // 析构 x 子树中的节点（不归还内存，由调用者整池释放）
+    static void destroyTask(Node* x, int cutoff, TaskGroup& group) {
+        while (x && x->size > cutoff) {
+            bool lb = leftBigger(x);
+            Node* big = lb ? x->left : x->right;
+            Node* small = lb ? x->right : x->left;
+            x->~Node();
+            if (small) group.spawn([small, cutoff, &group]() { destroyTask(small, cutoff, group); });
+            x = big;
+        }
+        // 顺序部分：与 BinaryTree::destroy 相同，右旋展平后逐个析构
+        while (x) {
+            if (x->left) {
+                Node* l = x->left;
+                x->left = l->right;
+                l->right = x;
+                x = l;
+            } else {
+                Node* r = x->right;
+                x->~Node();
+                x = r;
+            }
+        }
+    }
+
+    template <typename VST>
+    static void visitTask(Node* x, int cutoff, TaskGroup& group, VST& visit) {
+        while (x && x->size > cutoff) {
+            visit(x->data);
+            bool lb = leftBigger(x);
+            Node* small = lb ? x->right : x->left;
+            if (small) group.spawn([small, cutoff, &group, &visit]() { visitTask(small, cutoff, group, visit); });
+            x = lb ? x->left : x->right;
+        }
+        if (!x) return;
+        for (Node* y = Tree::firstIn(x), *end = Tree::succIn(Tree::lastIn(x)); y != end; y = Tree::succIn(y))
+            visit(y->data);
+    }
+
+    // x 子树首元素的中序秩为 base
+    template <typename R, typename Map, typename Combine>
+    static void reduceTask(Node* x, int base, int cutoff, TaskGroup& group, const R& identity,
+                           const Map& map, const Combine& combine, std::mutex& lock, Vector<Segment<R> >& segs) {
+        Vector<Segment<R> > local;
+        while (x && x->size > cutoff) {
+            int r = base + Tree::sizeOf(x->left);
+            Segment<R> s = { r, map(x->data) };
+            local.push_back(s);
+            bool lb = leftBigger(x);
+            Node* small = lb ? x->right : x->left;
+            int smallBase = lb ? r + 1 : base;
+            if (small)
+                group.spawn([small, smallBase, cutoff, &group, &identity, &map, &combine, &lock, &segs]() {
+                    reduceTask(small, smallBase, cutoff, group, identity, map, combine, lock, segs);
+                });
+            if (!lb) base = r + 1;
+            x = lb ? x->left : x->right;
+        }
+        if (x) {
+            R acc = identity;
+            for (Node* y = Tree::firstIn(x), *end = Tree::succIn(Tree::lastIn(x)); y != end; y = Tree::succIn(y))
+                acc = combine(acc, map(y->data));
+            Segment<R> s = { base, acc };
+            local.push_back(s);
+        }
+        std::lock_guard<std::mutex> guard(lock);
+        for (int i = 0; i < local.size(); ++i) segs.push_back(local[i]);
+    }
+
+    static void depthTask(const Tree& tree, Node* x, int level, int cutoff, TaskGroup& group, std::atomic<int>& best) {
+        while (x && x->size > cutoff) {
+            bool lb = leftBigger(x);
+            Node* small = lb ? x->right : x->left;
+            if (small)
+                group.spawn([&tree, small, level, cutoff, &group, &best]() {
+                    depthTask(tree, small, level + 1, cutoff, group, best);
+                });
+            x = lb ? x->left : x->right;
+            level++;
+        }
+        if (!x) return;
+        int d = level + tree.depth(x);
+        int cur = best.load();
+        while (d > cur && !best.compare_exchange_weak(cur, d)) {}
+    }
+
+public:
+    // dst = src
+    static void copy(Tree& dst, const Tree& src, int cutoff, ThreadPool& threads) {
+        if (&dst == &src) return;
+        dst.clear();
+        std::mutex lock;
+        Vector<Pool*> pools;
+        TaskGroup group(threads);
+        copyTask(src.root, nullptr, &dst.root, cutoff, group, lock, pools);
+        group.sync();
+        for (int i = 0; i < pools.size(); ++i) {
+            dst.pool.adopt(*pools[i]);
+            delete pools[i];
+        }
+        dst.size = src.size;
+    }
+
+    static void clear(Tree& tree, int cutoff, ThreadPool& threads) {
+        if (!std::is_trivially_destructible<Node>::value) {
+            TaskGroup group(threads);
+            destroyTask(tree.root, cutoff, group);
+            group.sync();
+        }
+        tree.pool.releaseAll();
+        tree.root = nullptr;
+        tree.size = 0;
+    }
+
+    template <typename VST>
+    static void visit(const Tree& tree, VST& visit, int cutoff, ThreadPool& threads) {
+        TaskGroup group(threads);
+        visitTask(tree.root, cutoff, group, visit);
+        group.sync();
+    }
+
+    template <typename R, typename Map, typename Combine>
+    static R reduce(const Tree& tree, const R& identity, const Map& map, const Combine& combine,
+                    int cutoff, ThreadPool& threads) {
+        std::mutex lock;
+        Vector<Segment<R> > segs;
+        TaskGroup group(threads);
+        reduceTask(tree.root, 0, cutoff, group, identity, map, combine, lock, segs);
+        group.sync();
+        segs.sort_merge();
+        R acc = identity;
+        for (int i = 0; i < segs.size(); ++i) acc = combine(acc, segs[i].value);
+        return acc;
+    }
+
+    static int depth(const Tree& tree, int cutoff, ThreadPool& threads) {
+        if (!tree.root) return -1;
+        std::atomic<int> best(0);
+        TaskGroup group(threads);
+        depthTask(tree, tree.root, 0, cutoff, group, best);
+        group.sync();
+        return best.load();
+    }
+};
+
+// 并行复制：dst 变为 src 的副本，结构、高度、子树规模与顺序复制完全相同
+template <typename T>
+void parallel_copy(BinaryTree<T>& dst, const BinaryTree<T>& src, int cutoff = 4096,
+                   ThreadPool& pool = ThreadPool::instance()) {
+    ParallelTree<T>::copy(dst, src, cutoff < 1 ? 1 : cutoff, pool);
+}
+
+// 并行清空：节点需要析构时并行析构，最后整池释放内存
+template <typename T>
+void parallel_clear(BinaryTree<T>& tree, int cutoff = 4096, ThreadPool& pool = ThreadPool::instance()) {
+    ParallelTree<T>::clear(tree, cutoff < 1 ? 1 : cutoff, pool);
+}
+
+// 并行访问每个元素一次，次序不定；visit 须可被多个线程同时调用
+template <typename T, typename VST>
+void parallel_visit(const BinaryTree<T>& tree, VST& visit, int cutoff = 4096,
+                    ThreadPool& pool = ThreadPool::instance()) {
+    ParallelTree<T>::visit(tree, visit, cutoff < 1 ? 1 : cutoff, pool);
+}
+
+// 并行归约：按中序计算 combine(...combine(combine(identity, map(e0)), map(e1))..., map(en-1))
+// combine 满足结合律且 identity 为其单位元时，结果与顺序归约相同
+template <typename T, typename R, typename Map, typename Combine>
+R parallel_reduce(const BinaryTree<T>& tree, const R& identity, const Map& map, const Combine& combine,
+                  int cutoff = 4096, ThreadPool& pool = ThreadPool::instance()) {
+    return ParallelTree<T>::reduce(tree, identity, map, combine, cutoff < 1 ? 1 : cutoff, pool);
+}
+
+// 并行重新计算树高（不读取根节点维护的高度）
+template <typename T>
+int parallel_depth(const BinaryTree<T>& tree, int cutoff = 4096, ThreadPool& pool = ThreadPool::instance()) {
+    return ParallelTree<T>::depth(tree, cutoff < 1 ? 1 : cutoff, pool);
+}
+
+#endif // PARALLEL_TREE_H
@@ -0,0 +1,233 @@
+#ifndef PERSISTENT_BST_H
+#define PERSISTENT_BST_H
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// 持久化（路径复制）平衡二叉搜索树
+// 节点一经创建便不再修改：插入、删除只复制自根至目标的路径（O(log n)个节点），
+// 其余子树由新旧版本共享。根指针以原子方式发布：读者取快照时不会因写者锁而阻塞，
+// 取得快照后的访问完全不加锁，快照在其生命期内保持不变；节点由引用计数管理，
+// 最后一个引用它的版本消失时才回收。写者之间以互斥锁串行化。
+// 注意shared_ptr的原子读写在常见标准库中并非无锁实现（libstdc++以全局分段互斥锁保护），
+// 取快照本身仍可能与其他读者、写者短暂竞争；C++20起改用std::atomic<std::shared_ptr>。沿路径按AVL规则重新平衡，树高（即复制路径长度）为O(log n)。
+template <typename T>
+class PersistentBST {
+private:
+    struct Node;
+    typedef std::shared_ptr<const Node> Ptr;
+
+    struct Node {
+        const T data;
+        const Ptr left;
+        const Ptr right;
+        const int height;  // 高度（叶节点为0）
+        const int size;    // 子树规模
+
+        Node(const T& d, const Ptr& l, const Ptr& r)
+            : data(d), left(l), right(r),
+              height(1 + std::max(stature(l), stature(r))),
+              size(1 + sizeOf(l) + sizeOf(r)) {}
+    };
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<Ptr> _root;  // 当前版本的根
+#else
+    Ptr _root;               // 当前版本的根，仅通过 std::atomic_load/atomic_store 访问
+#endif
+    std::mutex _writeLock;   // 写者互斥
+
+    Ptr loadRoot() const {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return _root.load();
+#else
+        return std::atomic_load(&_root);
+#endif
+    }
+
+    void storeRoot(const Ptr& root) {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        _root.store(root);
+#else
+        std::atomic_store(&_root, root);
+#endif
+    }
+
+    static int stature(const Ptr& x) { return x ? x->height : -1; }
+    static int sizeOf(const Ptr& x) { return x ? x->size : 0; }
+
+    static Ptr make(const T& d, const Ptr& l, const Ptr& r) {
+        return std::make_shared<const Node>(d, l, r);
+    }
+
+    // 以d为根、l和r为子树新建节点；左右高度差为2时做单旋或双旋（均只新建节点）
+    static Ptr balance(const T& d, const Ptr& l, const Ptr& r) {
+        int hl = stature(l), hr = stature(r);
+        if (hl > hr + 1) {
+            if (stature(l->left) >= stature(l->right))
+                return make(l->data, l->left, make(d, l->right, r));
+            return make(l->right->data, make(l->data, l->left, l->right->left),
+                        make(d, l->right->right, r));
+        }
+        if (hr > hl + 1) {
+            if (stature(r->right) >= stature(r->left))
+                return make(r->data, make(d, l, r->left), r->right);
+            return make(r->left->data, make(d, l, r->left->left),
+                        make(r->data, r->left->right, r->right));
+        }
+        return make(d, l, r);
+    }
+
+    // 返回插入val后的新子树；val已存在时返回原子树
+    static Ptr insertAt(const Ptr& x, const T& val) {
+        if (!x) return make(val, Ptr(), Ptr());
+        if (val < x->data) {
+            Ptr l = insertAt(x->left, val);
+            return l == x->left ? x : balance(x->data, l, x->right);
+        }
+        if (x->data < val) {
+            Ptr r = insertAt(x->right, val);
+            return r == x->right ? x : balance(x->data, x->left, r);
+        }
+        return x;
+    }
+
+    // 返回删除最小元素后的新子树，min为被删除的元素
+    static Ptr removeMin(const Ptr& x, const Node*& min) {
+        if (!x->left) {
+            min = x.get();
+            return x->right;
+        }
+        return balance(x->data, removeMin(x->left, min), x->right);
+    }
+
+    // 返回删除val后的新子树；val不存在时返回原子树
+    static Ptr removeAt(const Ptr& x, const T& val) {
+        if (!x) return x;
+        if (val < x->data) {
+            Ptr l = removeAt(x->left, val);
+            return l == x->left ? x : balance(x->data, l, x->right);
+        }
+        if (x->data < val) {
+            Ptr r = removeAt(x->right, val);
+            return r == x->right ? x : balance(x->data, x->left, r);
+        }
+        if (!x->left) return x->right;
+        if (!x->right) return x->left;
+        const Node* min;
+        Ptr r = removeMin(x->right, min);
+        return balance(min->data, x->left, r);
+    }
+
+public:
+    // 只读快照：持有某一版本的根，期间其他线程的更新不影响它
+    class Snapshot {
+    private:
+        Ptr _root;
+
+        template <typename VST>
+        static bool inOrderAt(const Node* x, VST& visit) {
+            if (!x) return true;
+            return inOrderAt(x->left.get(), visit) && call(visit, x->data) && inOrderAt(x->right.get(), visit);
+        }
+
+        template <typename VST>
+        static bool rangeAt(const Node* x, const T& lo, const T& hi, VST& visit) {
+            if (!x) return true;
+            if (lo < x->data && !rangeAt(x->left.get(), lo, hi, visit)) return false;
+            if (!(x->data < lo) && !(hi < x->data) && !call(visit, x->data)) return false;
+            if (x->data < hi) return rangeAt(x->right.get(), lo, hi, visit);
+            return true;
+        }
+
+        template <typename VST>
+        static auto call(VST& visit, const T& e, int) -> decltype(bool(visit(e))) {
+            return visit(e);
+        }
+
+        template <typename VST>
+        static bool call(VST& visit, const T& e, long) {
+            visit(e);
+            return true;
+        }
+
+        template <typename VST>
+        static bool call(VST& visit, const T& e) {
+            return call(visit, e, 0);
+        }
+
+    public:
+        explicit Snapshot(const Ptr& root) : _root(root) {}
+
+        bool empty() const { return !_root; }
+        int getSize() const { return sizeOf(_root); }
+        int depth() const { return stature(_root); }
+
+        // 查找元素，不存在时返回nullptr（指针在快照存续期间有效）
+        const T* search(const T& val) const {
+            const Node* x = _root.get();
+            while (x) {
+                if (val < x->data) x = x->left.get();
+                else if (x->data < val) x = x->right.get();
+                else return &x->data;
+            }
+            return nullptr;
+        }
+
+        // 中序遍历；访问器返回false时提前结束（递归深度为O(log n)）
+        template <typename VST>
+        bool inOrder(VST& visit) const {
+            return inOrderAt(_root.get(), visit);
+        }
+
+        // 按升序访问[lo, hi]内的元素，只进入与区间相交的子树
+        template <typename VST>
+        bool range(const T& lo, const T& hi, VST& visit) const {
+            return rangeAt(_root.get(), lo, hi, visit);
+        }
+    };
+
+    // 构造函数
+    PersistentBST() {}
+
+    PersistentBST(const PersistentBST&) = delete;
+    PersistentBST& operator=(const PersistentBST&) = delete;
+
+    // 取得当前版本的快照，不等待写者锁
+    Snapshot snapshot() const {
+        return Snapshot(loadRoot());
+    }
+
+    bool empty() const { return snapshot().empty(); }
+    int getSize() const { return snapshot().getSize(); }
+
+    // 插入元素，已存在时返回false
+    bool insert(const T& val) {
+        std::lock_guard<std::mutex> guard(_writeLock);
+        Ptr old = loadRoot();
+        Ptr now = insertAt(old, val);
+        if (now == old) return false;
+        storeRoot(now);
+        return true;
+    }
+
+    // 删除元素
+    bool remove(const T& val) {
+        std::lock_guard<std::mutex> guard(_writeLock);
+        Ptr old = loadRoot();
+        Ptr now = removeAt(old, val);
+        if (now == old) return false;
+        storeRoot(now);
+        return true;
+    }
+
+    // 清空：旧版本在最后一个快照释放后回收
+    void clear() {
+        std::lock_guard<std::mutex> guard(_writeLock);
+        storeRoot(Ptr());
+    }
+};
+
+#endif // PERSISTENT_BST_H
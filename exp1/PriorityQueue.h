@@ -0,0 +1,234 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include "Vector.h"
+#include <cassert>
+#include <algorithm>
+
+// 基于 Vector 的 d 叉堆优先级队列（大顶堆）
+// D 为堆的叉数：D = 4 或 8 时树高更低，同一节点的孩子落在同一缓存行内
+template <typename T, int D = 2>
+class PriorityQueue {
+private:
+    Vector<T> _elem;  // 完全 D 叉树的层次序列
+
+    static int parent(int i) { return (i - 1) / D; }
+    static int firstChild(int i) { return i * D + 1; }
+
+    // 上滤：空穴沿父链上移，最后只写一次
+    void percolateUp(int i) {
+        T e = _elem[i];
+        while (i > 0) {
+            int p = parent(i);
+            if (!(_elem[p] < e)) break;
+            _elem[i] = _elem[p];
+            i = p;
+        }
+        _elem[i] = e;
+    }
+
+    // 下滤：在至多 D 个孩子中选出最大者
+    void percolateDown(int i) {
+        int n = _elem.size();
+        T e = _elem[i];
+        for (;;) {
+            int c = firstChild(i);
+            if (c >= n) break;
+            int last = std::min(c + D, n);
+            int best = c;
+            for (int j = c + 1; j < last; ++j)
+                if (_elem[best] < _elem[j]) best = j;
+            if (!(e < _elem[best])) break;
+            _elem[i] = _elem[best];
+            i = best;
+        }
+        _elem[i] = e;
+    }
+
+    // Floyd 建堆：自底向上逐个下滤内部节点，O(n)
+    void heapify() {
+        if (_elem.size() < 2) return;
+        for (int i = parent(_elem.size() - 1); i >= 0; --i)
+            percolateDown(i);
+    }
+
+public:
+    // 构造函数
+    PriorityQueue() {}
+
+    // 由已有 Vector 批量建堆，O(n)
+    PriorityQueue(const Vector<T>& v) : _elem(v) {
+        heapify();
+    }
+
+    // 由数组批量建堆，O(n)
+    PriorityQueue(T* arr, int n) : _elem(arr, n) {
+        heapify();
+    }
+
+    int size() const { return _elem.size(); }
+    bool empty() const { return _elem.empty(); }
+
+    // 插入元素，O(log_D n)
+    void push(const T& e) {
+        _elem.push_back(e);
+        percolateUp(_elem.size() - 1);
+    }
+
+    // 批量插入：新增元素较多时整体重新建堆，否则逐个上滤
+    void push_bulk(const T* arr, int n) {
+        int old = _elem.size();
+        for (int i = 0; i < n; ++i) _elem.push_back(arr[i]);
+        if (n > old) {
+            heapify();
+        } else {
+            for (int i = old; i < old + n; ++i) percolateUp(i);
+        }
+    }
+
+    void push_bulk(const Vector<T>& v) {
+        int old = _elem.size();
+        for (int i = 0; i < v.size(); ++i) _elem.push_back(v[i]);
+        if (v.size() > old) {
+            heapify();
+        } else {
+            for (int i = old; i < _elem.size(); ++i) percolateUp(i);
+        }
+    }
+
+    // 获取最大元素
+    const T& top() const {
+        assert(!empty() && "PriorityQueue is empty!");
+        return _elem[0];
+    }
+
+    // 删除并返回最大元素，O(D log_D n)
+    T pop() {
+        assert(!empty() && "PriorityQueue is empty!");
+        T maxElem = _elem[0];
+        T last = _elem.pop_back();
+        if (!_elem.empty()) {
+            _elem[0] = last;
+            percolateDown(0);
+        }
+        return maxElem;
+    }
+
+    // 清空队列
+    void clear() {
+        _elem = Vector<T>();
+    }
+};
+
+// 带索引的 d 叉小顶堆，元素为 [0, n) 中的编号，按键值排序
+// 记录每个编号在堆中的位置，支持 decrease_key，适用于 Dijkstra、Prim 等图算法
+template <typename Key, int D = 2>
+class IndexedPriorityQueue {
+private:
+    Vector<int> _heap;  // 堆中存放编号
+    Vector<int> _pos;   // 编号 -> 堆中位置，-1 表示不在堆中
+    Vector<Key> _key;   // 编号 -> 键值
+    int _n;             // 编号上限
+
+    static int parent(int i) { return (i - 1) / D; }
+    static int firstChild(int i) { return i * D + 1; }
+
+    void place(int i, int id) {
+        _heap[i] = id;
+        _pos[id] = i;
+    }
+
+    void percolateUp(int i) {
+        int id = _heap[i];
+        while (i > 0) {
+            int p = parent(i);
+            if (!(_key[id] < _key[_heap[p]])) break;
+            place(i, _heap[p]);
+            i = p;
+        }
+        place(i, id);
+    }
+
+    void percolateDown(int i) {
+        int n = _heap.size();
+        int id = _heap[i];
+        for (;;) {
+            int c = firstChild(i);
+            if (c >= n) break;
+            int last = std::min(c + D, n);
+            int best = c;
+            for (int j = c + 1; j < last; ++j)
+                if (_key[_heap[j]] < _key[_heap[best]]) best = j;
+            if (!(_key[_heap[best]] < _key[id])) break;
+            place(i, _heap[best]);
+            i = best;
+        }
+        place(i, id);
+    }
+
+public:
+    // 构造函数，编号范围为 [0, n)
+    IndexedPriorityQueue(int n) : _heap(n), _pos(n), _key(n), _n(n) {
+        for (int i = 0; i < n; ++i) {
+            _pos.push_back(-1);
+            _key.push_back(Key());
+        }
+    }
+
+    int size() const { return _heap.size(); }
+    bool empty() const { return _heap.empty(); }
+
+    // 判断编号是否在堆中
+    bool contains(int id) const {
+        assert(0 <= id && id < _n);
+        return _pos[id] >= 0;
+    }
+
+    // 获取编号当前的键值
+    const Key& key_of(int id) const {
+        assert(contains(id));
+        return _key[id];
+    }
+
+    // 插入编号及其键值
+    void push(int id, const Key& k) {
+        assert(!contains(id) && "id already in queue!");
+        _key[id] = k;
+        _heap.push_back(id);
+        _pos[id] = _heap.size() - 1;
+        percolateUp(_heap.size() - 1);
+    }
+
+    // 将编号的键值减小为 k，O(log_D n)
+    void decrease_key(int id, const Key& k) {
+        assert(contains(id) && !(_key[id] < k));
+        _key[id] = k;
+        percolateUp(_pos[id]);
+    }
+
+    // 键值最小的编号
+    int top() const {
+        assert(!empty() && "IndexedPriorityQueue is empty!");
+        return _heap[0];
+    }
+
+    // 键值最小的编号对应的键值
+    const Key& top_key() const {
+        return _key[top()];
+    }
+
+    // 删除并返回键值最小的编号
+    int pop() {
+        assert(!empty() && "IndexedPriorityQueue is empty!");
+        int minId = _heap[0];
+        int last = _heap.pop_back();
+        _pos[minId] = -1;
+        if (!_heap.empty()) {
+            place(0, last);
+            percolateDown(0);
+        }
+        return minId;
+    }
+};
+
+#endif // PRIORITY_QUEUE_H
@@ -0,0 +1,237 @@
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <cassert>
+#include <new>
+
+// 跳表节点：每层前向指针附带跨度（沿该指针前进会越过的底层节点数）
+template <typename T>
+struct SkipNode {
+    struct Link {
+        SkipNode<T>* next;  // 本层后继
+        int span;           // 跨度
+    };
+
+    T data;          // 节点数据
+    int level;       // 层数
+    Link forward[1]; // 各层前向指针（实际长度为 level，随节点一起分配）
+
+    SkipNode<T>* next() const { return forward[0].next; }
+};
+
+// 可索引跳表：有序、无重复元素
+// 查找、插入、删除以及按秩访问 at(r)、求秩 rank(e) 的期望时间均为 O(log n)。
+// 晋升概率取 1/4，平均每个节点只需 4/3 个前向指针。
+template <typename T>
+class SkipList {
+private:
+    static const int MAX_LEVEL = 32;
+
+    typedef SkipNode<T> Node;
+
+    Node* header;       // 头哨兵，拥有 MAX_LEVEL 层
+    int _level;         // 当前最高层数
+    int _size;          // 规模
+    unsigned _seed;     // 随机数种子
+
+    // 申请含 level 层前向指针的节点
+    static Node* createNode(int level, const T& e) {
+        void* mem = ::operator new(sizeof(Node) + (level - 1) * sizeof(typename Node::Link));
+        Node* x = static_cast<Node*>(mem);
+        new (&x->data) T(e);
+        x->level = level;
+        for (int i = 0; i < level; ++i) {
+            x->forward[i].next = nullptr;
+            x->forward[i].span = 0;
+        }
+        return x;
+    }
+
+    static void destroyNode(Node* x) {
+        x->data.~T();
+        ::operator delete(x);
+    }
+
+    // 随机层数：每层以 1/4 概率晋升
+    int randomLevel() {
+        int level = 1;
+        for (;;) {
+            _seed ^= _seed << 13;
+            _seed ^= _seed >> 17;
+            _seed ^= _seed << 5;
+            if ((_seed & 3) != 0 || level >= MAX_LEVEL) break;
+            level++;
+        }
+        return level;
+    }
+
+    // 自顶向下找到各层中最后一个小于 e 的节点，rank[i] 为其秩（头哨兵为 0）
+    Node* findPredecessors(const T& e, Node** update, int* rank) const {
+        Node* x = header;
+        for (int i = _level - 1; i >= 0; --i) {
+            rank[i] = (i == _level - 1) ? 0 : rank[i + 1];
+            while (x->forward[i].next && x->forward[i].next->data < e) {
+                rank[i] += x->forward[i].span;
+                x = x->forward[i].next;
+            }
+            update[i] = x;
+        }
+        return x->forward[0].next;
+    }
+
+public:
+    // 构造函数
+    SkipList(unsigned seed = 2463534242u) : _level(1), _size(0), _seed(seed ? seed : 1) {
+        header = createNode(MAX_LEVEL, T());
+    }
+
+    // 析构函数
+    ~SkipList() {
+        clear();
+        destroyNode(header);
+    }
+
+    SkipList(const SkipList&) = delete;
+    SkipList& operator=(const SkipList&) = delete;
+
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    // 首节点，空表时为 nullptr；沿 next() 按升序遍历
+    Node* first() const { return header->forward[0].next; }
+
+    // 清空
+    void clear() {
+        Node* x = header->forward[0].next;
+        while (x) {
+            Node* next = x->forward[0].next;
+            destroyNode(x);
+            x = next;
+        }
+        for (int i = 0; i < MAX_LEVEL; ++i) {
+            header->forward[i].next = nullptr;
+            header->forward[i].span = 0;
+        }
+        _level = 1;
+        _size = 0;
+    }
+
+    // 查找元素，不存在时返回 nullptr
+    Node* search(const T& e) const {
+        Node* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        Node* x = findPredecessors(e, update, rank);
+        return (x && !(e < x->data)) ? x : nullptr;
+    }
+
+    // 第一个不小于 e 的节点，不存在时返回 nullptr
+    Node* lower_bound(const T& e) const {
+        Node* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        return findPredecessors(e, update, rank);
+    }
+
+    // 插入元素，已存在时返回 nullptr
+    Node* insert(const T& e) {
+        Node* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        Node* x = findPredecessors(e, update, rank);
+        if (x && !(e < x->data)) return nullptr;  // 不允许重复元素
+
+        int level = randomLevel();
+        if (level > _level) {
+            for (int i = _level; i < level; ++i) {
+                rank[i] = 0;
+                update[i] = header;
+                header->forward[i].span = _size;
+            }
+            _level = level;
+        }
+
+        x = createNode(level, e);
+        for (int i = 0; i < level; ++i) {
+            x->forward[i].next = update[i]->forward[i].next;
+            update[i]->forward[i].next = x;
+            // 新节点秩为 rank[0] + 1，据此拆分原跨度
+            x->forward[i].span = update[i]->forward[i].span - (rank[0] - rank[i]);
+            update[i]->forward[i].span = rank[0] - rank[i] + 1;
+        }
+        for (int i = level; i < _level; ++i)
+            update[i]->forward[i].span++;
+
+        _size++;
+        return x;
+    }
+
+    // 删除元素，不存在时返回 false
+    bool remove(const T& e) {
+        Node* update[MAX_LEVEL];
+        int rank[MAX_LEVEL];
+        Node* x = findPredecessors(e, update, rank);
+        if (!x || e < x->data) return false;
+
+        for (int i = 0; i < _level; ++i) {
+            if (update[i]->forward[i].next == x) {
+                update[i]->forward[i].span += x->forward[i].span - 1;
+                update[i]->forward[i].next = x->forward[i].next;
+            } else {
+                update[i]->forward[i].span--;
+            }
+        }
+        while (_level > 1 && !header->forward[_level - 1].next)
+            _level--;
+
+        destroyNode(x);
+        _size--;
+        return true;
+    }
+
+    // 按秩访问（秩从 0 开始），O(log n)
+    Node* nodeAt(int r) const {
+        assert(0 <= r && r < _size);
+        int target = r + 1;
+        int traversed = 0;
+        Node* x = header;
+        for (int i = _level - 1; i >= 0; --i) {
+            while (x->forward[i].next && traversed + x->forward[i].span <= target) {
+                traversed += x->forward[i].span;
+                x = x->forward[i].next;
+            }
+            if (traversed == target) return x;
+        }
+        return nullptr;
+    }
+
+    T& at(int r) { return nodeAt(r)->data; }
+    const T& at(int r) const { return nodeAt(r)->data; }
+    const T& operator[](int r) const { return nodeAt(r)->data; }
+
+    // 元素的秩（从 0 开始），不存在时返回 -1
+    int rank(const T& e) const {
+        Node* x = header;
+        int r = 0;
+        for (int i = _level - 1; i >= 0; --i) {
+            while (x->forward[i].next && !(e < x->forward[i].next->data)) {
+                r += x->forward[i].span;
+                x = x->forward[i].next;
+            }
+            if (x != header && !(x->data < e)) return r - 1;
+        }
+        return -1;
+    }
+
+    // 节点的秩
+    int rank(const Node* x) const {
+        assert(x);
+        return rank(x->data);
+    }
+
+    // 遍历
+    template <typename VST>
+    void traverse(VST& visit) {
+        for (Node* x = first(); x; x = x->next())
+            visit(x->data);
+    }
+};
+
+#endif // SKIP_LIST_H
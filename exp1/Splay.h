@@ -0,0 +1,143 @@
+#ifndef SPLAY_H
+#define SPLAY_H
+
+#include "Tree.h"
+
+// 伸展树：每次查找、插入、删除都把被访问的节点转到根，刚访问过的关键码再次访问时路径很短
+// 接口与BST相同，单次操作分摊O(log n)；访问分布越偏斜（少数热点键），平均路径越短。
+// 采用自顶向下伸展：自根下行的同时把路径拆入左、右两棵临时树，一趟完成，无需递归。
+// 伸展后沿临时树的拼接边自底向上更新高度与子树规模，select、rank等继承的查询照常可用。
+// const对象上的search不伸展（即BST::search）。
+template <typename T>
+class Splay : public BST<T> {
+private:
+    typedef TreeNode<T> Node;
+
+    // 自顶向下伸展：把val所在节点（不存在时为查找路径上最后一个节点）转到根
+    void splay(const T& val) {
+        Node* t = this->root;
+        if (!t) return;
+        Node* lRoot = nullptr;  // 左树：均小于val，新节点接在其最大节点lMax的右侧
+        Node* lMax = nullptr;
+        Node* rRoot = nullptr;  // 右树：均大于val，新节点接在其最小节点rMin的左侧
+        Node* rMin = nullptr;
+        while (true) {
+            if (val < t->data) {
+                if (!t->left) break;
+                if (val < t->left->data) {  // zig-zig：先右旋
+                    Node* y = t->left;
+                    t->left = y->right;
+                    if (t->left) t->left->parent = t;
+                    y->right = t;
+                    t->parent = y;
+                    this->update(t);
+                    t = y;
+                    if (!t->left) break;
+                }
+                // t及其右子树并入右树
+                if (rMin) rMin->left = t;
+                else rRoot = t;
+                t->parent = rMin;
+                rMin = t;
+                t = t->left;
+            } else if (t->data < val) {
+                if (!t->right) break;
+                if (t->right->data < val) {  // zag-zag：先左旋
+                    Node* y = t->right;
+                    t->right = y->left;
+                    if (t->right) t->right->parent = t;
+                    y->left = t;
+                    t->parent = y;
+                    this->update(t);
+                    t = y;
+                    if (!t->right) break;
+                }
+                // t及其左子树并入左树
+                if (lMax) lMax->right = t;
+                else lRoot = t;
+                t->parent = lMax;
+                lMax = t;
+                t = t->right;
+            } else {
+                break;
+            }
+        }
+        // 拼接：t的左、右子树分别接到左树最大节点之右、右树最小节点之左，两树再作为t的孩子
+        if (lMax) {
+            lMax->right = t->left;
+            if (t->left) t->left->parent = lMax;
+            for (Node* x = lMax; x; x = x->parent) this->update(x);
+            t->left = lRoot;
+            lRoot->parent = t;
+        }
+        if (rMin) {
+            rMin->left = t->right;
+            if (t->right) t->right->parent = rMin;
+            for (Node* x = rMin; x; x = x->parent) this->update(x);
+            t->right = rRoot;
+            rRoot->parent = t;
+        }
+        t->parent = nullptr;
+        this->update(t);
+        this->root = t;
+    }
+
+public:
+    using BST<T>::search;
+
+    // 查找元素并把它（未命中时为最后访问的节点）伸展到根
+    Node* search(const T& val) {
+        splay(val);
+        return (this->root && this->root->data == val) ? this->root : nullptr;
+    }
+
+    // 插入元素，已存在时返回nullptr；新节点成为根
+    Node* insert(const T& val) {
+        if (!this->root) return this->attach(val, nullptr);
+        splay(val);
+        Node* t = this->root;
+        if (t->data == val) return nullptr;  // 不允许重复元素
+        Node* x = this->pool.create(val, nullptr);
+        if (val < t->data) {  // t及其右子树成为x的右孩子
+            x->left = t->left;
+            x->right = t;
+            t->left = nullptr;
+        } else {
+            x->right = t->right;
+            x->left = t;
+            t->right = nullptr;
+        }
+        if (x->left) x->left->parent = x;
+        if (x->right) x->right->parent = x;
+        this->update(t);
+        this->update(x);
+        this->root = x;
+        this->size++;
+        return x;
+    }
+
+    // 删除元素：伸展到根后摘除，再把左子树的最大者伸展上来接管右子树
+    bool remove(const T& val) {
+        splay(val);
+        Node* t = this->root;
+        if (!t || !(t->data == val)) return false;
+        Node* l = t->left;
+        Node* r = t->right;
+        this->pool.destroy(t);
+        this->size--;
+        if (!l) {
+            this->root = r;
+            if (r) r->parent = nullptr;
+            return true;
+        }
+        l->parent = nullptr;
+        this->root = l;
+        splay(val);  // 左子树中所有元素均小于val，最大者被转到根，其右孩子为空
+        this->root->right = r;
+        if (r) r->parent = this->root;
+        this->update(this->root);
+        return true;
+    }
+};
+
+#endif // SPLAY_H
@@ -0,0 +1,340 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "Queue.h"
+#include "Vector.h"
+#include <algorithm>
+#include <cassert>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// 任务：可调用对象加所属任务组
+struct Task {
+    std::function<void()> fn;
+    std::atomic<int>* pending;  // 所属任务组的未完成计数
+};
+
+// Chase-Lev 工作窃取双端队列
+// 所有者线程在底部 push/pop（LIFO，缓存局部性好），其他线程在顶部 steal（FIFO，偷走较大的任务）。
+// 环形数组满时加倍；旧数组可能仍被窃取者读取，因此延迟到析构时释放。
+class WorkStealingDeque {
+private:
+    struct Array {
+        long capacity;
+        std::atomic<Task*>* slots;
+
+        Array(long cap) : capacity(cap), slots(new std::atomic<Task*>[cap]) {}
+        ~Array() { delete[] slots; }
+
+        Task* get(long i) const { return slots[i & (capacity - 1)].load(std::memory_order_relaxed); }
+        void put(long i, Task* t) { slots[i & (capacity - 1)].store(t, std::memory_order_relaxed); }
+
+        Array* grow(long bottom, long top) const {
+            Array* a = new Array(capacity * 2);
+            for (long i = top; i < bottom; ++i) a->put(i, get(i));
+            return a;
+        }
+    };
+
+    std::atomic<long> _top;     // 窃取端
+    char _pad[64];              // 隔开 _top 与 _bottom，避免伪共享
+    std::atomic<long> _bottom;  // 所有者端
+    std::atomic<Array*> _array;
+    Vector<Array*> _retired;  // 扩容后淘汰的旧数组（仅所有者访问）
+
+public:
+    WorkStealingDeque(long capacity = 256) : _top(0), _bottom(0), _array(new Array(capacity)) {}
+
+    ~WorkStealingDeque() {
+        delete _array.load();
+        for (int i = 0; i < _retired.size(); ++i) delete _retired[i];
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // 所有者压入任务
+    void push(Task* t) {
+        long b = _bottom.load(std::memory_order_relaxed);
+        long top = _top.load(std::memory_order_acquire);
+        Array* a = _array.load(std::memory_order_relaxed);
+        if (b - top > a->capacity - 1) {
+            Array* bigger = a->grow(b, top);
+            _retired.push_back(a);
+            _array.store(bigger, std::memory_order_release);
+            a = bigger;
+        }
+        a->put(b, t);
+        std::atomic_thread_fence(std::memory_order_release);
+        _bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // 所有者弹出最近压入的任务，队空返回 nullptr
+    Task* pop() {
+        long b = _bottom.load(std::memory_order_relaxed) - 1;
+        Array* a = _array.load(std::memory_order_relaxed);
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long t = _top.load(std::memory_order_relaxed);
+        if (t > b) {
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Task* task = a->get(b);
+        if (t == b) {
+            // 只剩最后一个任务，与窃取者竞争
+            if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                task = nullptr;
+            _bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    // 其他线程窃取最早压入的任务，失败返回 nullptr
+    Task* steal() {
+        long t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        long b = _bottom.load(std::memory_order_acquire);
+        if (t >= b) return nullptr;
+        Array* a = _array.load(std::memory_order_acquire);
+        Task* task = a->get(t);
+        if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+        return task;
+    }
+
+    bool empty() const {
+        return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+    }
+};
+
+// 工作窃取线程池
+// 每个工作线程拥有一个 WorkStealingDeque；工作线程内 spawn 的任务压入自己的队列，
+// 外部线程提交的任务进入加锁的注入队列。空闲线程依次尝试：本地队列、注入队列、随机窃取。
+class ThreadPool {
+private:
+    Vector<WorkStealingDeque*> _deques;  // 每个工作线程的任务队列
+    Vector<std::thread*> _workers;       // 工作线程
+    Queue<Task*> _injected;              // 外部线程提交的任务
+    std::mutex _injectLock;
+
+    std::atomic<bool> _stop;
+    std::atomic<int> _queued;    // 已提交但尚未被取走的任务数
+    std::atomic<int> _sleepers;  // 正在休眠的工作线程数
+    std::mutex _sleepLock;
+    std::condition_variable _wakeup;
+
+    // 当前线程所属的线程池与编号，非工作线程为 (nullptr, -1)
+    struct WorkerInfo {
+        ThreadPool* pool;
+        int index;
+        unsigned seed;
+    };
+
+    static WorkerInfo& self() {
+        static thread_local WorkerInfo info = { nullptr, -1, 0 };
+        return info;
+    }
+
+    int workerIndex() const {
+        return self().pool == this ? self().index : -1;
+    }
+
+    Task* popInjected() {
+        std::lock_guard<std::mutex> guard(_injectLock);
+        return _injected.empty() ? nullptr : _injected.dequeue();
+    }
+
+    // 从其他工作线程随机起点轮询窃取
+    Task* stealAny(int me) {
+        int n = _deques.size();
+        unsigned& seed = self().seed;
+        seed = seed * 1103515245u + 12345u;
+        int start = (int)((seed >> 16) % (unsigned)n);
+        for (int k = 0; k < n; ++k) {
+            int victim = (start + k) % n;
+            if (victim == me) continue;
+            Task* t = _deques[victim]->steal();
+            if (t) return t;
+        }
+        return nullptr;
+    }
+
+    // 按本地、注入、窃取的顺序取一个任务
+    Task* findTask(int me) {
+        Task* t = nullptr;
+        if (me >= 0) t = _deques[me]->pop();
+        if (!t) t = popInjected();
+        if (!t) t = stealAny(me);
+        if (t) _queued.fetch_sub(1);
+        return t;
+    }
+
+    static void execute(Task* t) {
+        t->fn();
+        t->pending->fetch_sub(1, std::memory_order_release);
+        delete t;
+    }
+
+    static void pin(int cpu) {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu % std::max(1, (int)std::thread::hardware_concurrency()), &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void)cpu;
+#endif
+    }
+
+    void workerLoop(int index, bool pinned) {
+        WorkerInfo& info = self();
+        info.pool = this;
+        info.index = index;
+        info.seed = (unsigned)index * 2654435761u + 1;
+        if (pinned) pin(index);
+
+        int idle = 0;
+        while (!_stop.load(std::memory_order_relaxed)) {
+            Task* t = findTask(index);
+            if (t) {
+                execute(t);
+                idle = 0;
+                continue;
+            }
+            if (++idle < 64) {
+                std::this_thread::yield();
+                continue;
+            }
+            // 长时间无任务则休眠，等待 submit 唤醒
+            std::unique_lock<std::mutex> lock(_sleepLock);
+            _sleepers.fetch_add(1);
+            _wakeup.wait_for(lock, std::chrono::milliseconds(10), [this]() {
+                return _stop.load() || _queued.load() > 0;
+            });
+            _sleepers.fetch_sub(1);
+            idle = 0;
+        }
+    }
+
+    void submit(Task* t) {
+        _queued.fetch_add(1);
+        int me = workerIndex();
+        if (me >= 0) {
+            _deques[me]->push(t);
+        } else {
+            std::lock_guard<std::mutex> guard(_injectLock);
+            _injected.enqueue(t);
+        }
+        if (_sleepers.load() > 0) {
+            std::lock_guard<std::mutex> guard(_sleepLock);
+            _wakeup.notify_one();
+        }
+    }
+
+public:
+    // 构造函数：threads <= 0 时取硬件线程数；pinned 为真时把第 i 个工作线程绑定到第 i 个 CPU
+    ThreadPool(int threads = 0, bool pinned = false) : _stop(false), _queued(0), _sleepers(0) {
+        if (threads <= 0) threads = std::max(1, (int)std::thread::hardware_concurrency());
+        for (int i = 0; i < threads; ++i) _deques.push_back(new WorkStealingDeque());
+        for (int i = 0; i < threads; ++i)
+            _workers.push_back(new std::thread(&ThreadPool::workerLoop, this, i, pinned));
+    }
+
+    // 析构函数：调用前应已 sync 所有任务组
+    ~ThreadPool() {
+        _stop.store(true);
+        {
+            std::lock_guard<std::mutex> guard(_sleepLock);
+            _wakeup.notify_all();
+        }
+        for (int i = 0; i < _workers.size(); ++i) {
+            _workers[i]->join();
+            delete _workers[i];
+        }
+        for (int i = 0; i < _deques.size(); ++i) delete _deques[i];
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return _workers.size(); }
+
+    // 执行一个待处理任务（供 sync 等待时帮忙），没有任务时返回 false
+    bool runOne() {
+        Task* t = findTask(workerIndex());
+        if (!t) return false;
+        execute(t);
+        return true;
+    }
+
+    // 进程内共享的默认线程池
+    static ThreadPool& instance() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    friend class TaskGroup;
+};
+
+// 任务组：fork/join 接口
+// spawn 派生子任务，sync 等待本组全部任务完成；等待期间当前线程继续执行池中的任务而不是空转。
+class TaskGroup {
+private:
+    ThreadPool& _pool;
+    std::atomic<int> _pending;  // 未完成的任务数
+
+public:
+    TaskGroup(ThreadPool& pool = ThreadPool::instance()) : _pool(pool), _pending(0) {}
+
+    ~TaskGroup() { sync(); }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    // 派生子任务
+    void spawn(const std::function<void()>& fn) {
+        _pending.fetch_add(1, std::memory_order_relaxed);
+        Task* t = new Task;
+        t->fn = fn;
+        t->pending = &_pending;
+        _pool.submit(t);
+    }
+
+    // 等待本组全部任务完成
+    void sync() {
+        while (_pending.load(std::memory_order_acquire) > 0) {
+            if (!_pool.runOne()) std::this_thread::yield();
+        }
+    }
+};
+
+// 区间 [lo, hi) 的递归二分：每次把右半段派生为子任务，左半段继续切分，直到不超过 grain
+template <typename F>
+void parallelForRange(TaskGroup& group, int lo, int hi, int grain, const F& f) {
+    while (hi - lo > grain) {
+        int mid = lo + (hi - lo) / 2;
+        group.spawn([&group, mid, hi, grain, &f]() { parallelForRange(group, mid, hi, grain, f); });
+        hi = mid;
+    }
+    for (int i = lo; i < hi; ++i) f(i);
+}
+
+// 并行执行 f(i)，i 取遍 [lo, hi)；grain 为每个任务至少处理的下标数
+template <typename F>
+void parallel_for(int lo, int hi, int grain, const F& f, ThreadPool& pool = ThreadPool::instance()) {
+    if (grain < 1) grain = 1;
+    TaskGroup group(pool);
+    parallelForRange(group, lo, hi, grain, f);
+    group.sync();
+}
+
+#endif // THREAD_POOL_H
@@ -1,90 +1,192 @@
 #ifndef TREE_H
 #define TREE_H
 
+#include "NodePool.h"
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <queue>
-#include <stack>
+#include <type_traits>
+
+// 集合运算与批量操作以Vector交换数据；为免把Vector.h（及其using namespace std）带给所有使用者，
+// 此处只作前置声明，调用这些接口时须自行包含Vector.h
+template <typename T> class Vector;
+
+// 节点增广钩子：为某个T特化TreeAugment，即可在每个节点上维护子树聚合值（如和、最小值）
+// value作为基类并入TreeNode（默认为空类，不占空间）；pull(x)由x的数据及其孩子（可能为空）
+// 重新计算x的聚合值，插入、删除、旋转后与高度、子树规模一起自底向上调用
+template <typename T>
+struct TreeAugment {
+    struct value {};
+
+    template <typename Node>
+    static void pull(Node*) {}
+};
 
 // 二叉树节点结构
 template <typename T>
-struct TreeNode {
+struct TreeNode : TreeAugment<T>::value {
     T data;               // 节点数据
     TreeNode* left;       // 左子节点
     TreeNode* right;      // 右子节点
     TreeNode* parent;     // 父节点
+    int height;           // 高度（叶节点为0，空树为-1）
+    int size;             // 子树规模（含自身）
 
     // 构造函数
     TreeNode(const T& val, TreeNode* p = nullptr, 
              TreeNode* l = nullptr, TreeNode* r = nullptr)
-        : data(val), parent(p), left(l), right(r) {}
+        : data(val), left(l), right(r), parent(p), height(0), size(1) {}
 };
 
 // 二叉树类
 template <typename T>
 class BinaryTree {
+    template <typename U> friend class ParallelTree;
+    template <typename U> friend class TreeFile;
+
 protected:
     TreeNode<T>* root;    // 根节点
     int size;             // 节点数量
+    NodePool<TreeNode<T> > pool;  // 节点池（每棵树独占）：节点成块分配，整树可O(1)释放
 
-    // 递归销毁树
+    // 销毁子树：不断右旋把左孩子提上来，左子树为空时删除当前节点并转入右子树
+    // 无需递归和辅助栈，退化为长链的树也不会栈溢出
     void destroy(TreeNode<T>* node) {
-        if (node) {
-            destroy(node->left);
-            destroy(node->right);
-            delete node;
-            size--;
+        while (node) {
+            if (node->left) {
+                TreeNode<T>* l = node->left;
+                node->left = l->right;
+                l->right = node;
+                node = l;
+            } else {
+                TreeNode<T>* r = node->right;
+                pool.destroy(node);
+                size--;
+                node = r;
+            }
         }
     }
 
-    // 递归复制树
-    TreeNode<T>* copy(TreeNode<T>* node, TreeNode<T>* parent) {
+    // 复制子树（新节点取自p）：源树与新树沿父指针同步游走，O(1)辅助空间；回溯时重算节点的维护信息
+    static TreeNode<T>* copy(const TreeNode<T>* node, TreeNode<T>* parent, NodePool<TreeNode<T> >& p) {
         if (!node) return nullptr;
-        TreeNode<T>* newNode = new TreeNode<T>(node->data, parent);
-        newNode->left = copy(node->left, newNode);
-        newNode->right = copy(node->right, newNode);
-        return newNode;
+        TreeNode<T>* top = p.create(node->data, parent);
+        const TreeNode<T>* src = node;
+        TreeNode<T>* dst = top;
+        while (true) {
+            if (src->left && !dst->left) {
+                dst->left = p.create(src->left->data, dst);
+                src = src->left;
+                dst = dst->left;
+            } else if (src->right && !dst->right) {
+                dst->right = p.create(src->right->data, dst);
+                src = src->right;
+                dst = dst->right;
+            } else {
+                update(dst);
+                if (src == node) break;
+                src = src->parent;
+                dst = dst->parent;
+            }
+        }
+        return top;
     }
 
-    // 递归前序遍历
-    void preOrderRecursive(TreeNode<T>* node, void (*visit)(const T&)) const {
-        if (node) {
-            visit(node->data);
-            preOrderRecursive(node->left, visit);
-            preOrderRecursive(node->right, visit);
-        }
+    // 沿父指针的无栈遍历：中序、前序、后序的首节点与直接后继
+    static TreeNode<T>* firstIn(TreeNode<T>* x) {
+        if (x) while (x->left) x = x->left;
+        return x;
     }
 
-    // 递归中序遍历
-    void inOrderRecursive(TreeNode<T>* node, void (*visit)(const T&)) const {
-        if (node) {
-            inOrderRecursive(node->left, visit);
-            visit(node->data);
-            inOrderRecursive(node->right, visit);
-        }
+    static TreeNode<T>* succIn(TreeNode<T>* x) {
+        if (x->right) return firstIn(x->right);
+        while (x->parent && x == x->parent->right) x = x->parent;
+        return x->parent;
+    }
+
+    static TreeNode<T>* lastIn(TreeNode<T>* x) {
+        if (x) while (x->right) x = x->right;
+        return x;
+    }
+
+    static TreeNode<T>* predIn(TreeNode<T>* x) {
+        if (x->left) return lastIn(x->left);
+        while (x->parent && x == x->parent->left) x = x->parent;
+        return x->parent;
+    }
+
+    static TreeNode<T>* succPre(TreeNode<T>* x) {
+        if (x->left) return x->left;
+        if (x->right) return x->right;
+        while (x->parent && (x == x->parent->right || !x->parent->right)) x = x->parent;
+        return x->parent ? x->parent->right : nullptr;
+    }
+
+    static TreeNode<T>* firstPost(TreeNode<T>* x) {
+        if (x) while (x->left || x->right) x = x->left ? x->left : x->right;
+        return x;
+    }
+
+    static TreeNode<T>* succPost(TreeNode<T>* x) {
+        TreeNode<T>* p = x->parent;
+        if (p && x == p->left && p->right) return firstPost(p->right);
+        return p;
     }
 
-    // 递归后序遍历
-    void postOrderRecursive(TreeNode<T>* node, void (*visit)(const T&)) const {
-        if (node) {
-            postOrderRecursive(node->left, visit);
-            postOrderRecursive(node->right, visit);
-            visit(node->data);
+    // 把from至to的右链反转（to->right须为空），Morris后序遍历使用
+    static void reverseRight(TreeNode<T>* from, TreeNode<T>* to) {
+        TreeNode<T>* prev = nullptr;
+        TreeNode<T>* x = from;
+        while (true) {
+            TreeNode<T>* next = x->right;
+            x->right = prev;
+            if (x == to) break;
+            prev = x;
+            x = next;
         }
     }
 
+    // 调用访问器：返回bool的访问器返回false时提前结束遍历，返回void的访问器总是继续
+    template <typename VST>
+    static auto call(VST& visit, const T& e, int) -> decltype(bool(visit(e))) {
+        return visit(e);
+    }
+
+    template <typename VST>
+    static bool call(VST& visit, const T& e, long) {
+        visit(e);
+        return true;
+    }
+
+    template <typename VST>
+    static bool call(VST& visit, const T& e) {
+        return call(visit, e, 0);
+    }
+
+    // 逆序访问from至to的右链；go为false后只恢复结构不再访问
+    template <typename VST>
+    static void visitRightReverse(TreeNode<T>* from, TreeNode<T>* to, VST& visit, bool& go) {
+        reverseRight(from, to);
+        for (TreeNode<T>* x = to; x && go; x = x->right) go = call(visit, x->data);
+        reverseRight(to, from);
+    }
+
 public:
     // 构造函数
     BinaryTree() : root(nullptr), size(0) {}
 
     // 拷贝构造函数
     BinaryTree(const BinaryTree<T>& other) {
-        root = copy(other.root, nullptr);
+        pool.reserve(other.size);  // 副本节点按前序连续存放
+        root = copy(other.root, nullptr, pool);
         size = other.size;
     }
 
     // 析构函数
-    ~BinaryTree() {
+    virtual ~BinaryTree() {
         clear();
     }
 
@@ -92,7 +194,8 @@ public:
     BinaryTree<T>& operator=(const BinaryTree<T>& other) {
         if (this != &other) {
             clear();
-            root = copy(other.root, nullptr);
+            pool.reserve(other.size);
+            root = copy(other.root, nullptr, pool);
             size = other.size;
         }
         return *this;
@@ -104,33 +207,51 @@ public:
     // 获取树的大小
     int getSize() const { return size; }
 
-    // 清空树
+    // 清空树：节点无需析构时整池释放，O(块数)；否则逐个析构
     void clear() {
-        destroy(root);
+        if (std::is_trivially_destructible<TreeNode<T> >::value) {
+            pool.releaseAll();
+            size = 0;
+        } else {
+            destroy(root);
+        }
         root = nullptr;
     }
 
     // 获取根节点
     TreeNode<T>* getRoot() const { return root; }
 
-    // 前序遍历（递归）
-    void preOrder(void (*visit)(const T&)) const {
-        preOrderRecursive(root, visit);
+    // 遍历接口接受任意可调用对象（函数、函数对象、lambda），调用可内联
+    // 访问器返回bool时，返回false即提前结束；遍历完整结束时返回true
+
+    // 前序遍历（沿父指针，无栈）
+    template <typename VST>
+    bool preOrder(VST& visit) const {
+        for (TreeNode<T>* x = root; x; x = succPre(x))
+            if (!call(visit, x->data)) return false;
+        return true;
     }
 
-    // 中序遍历（递归）
-    void inOrder(void (*visit)(const T&)) const {
-        inOrderRecursive(root, visit);
+    // 中序遍历（沿父指针，无栈）
+    template <typename VST>
+    bool inOrder(VST& visit) const {
+        for (TreeNode<T>* x = firstIn(root); x; x = succIn(x))
+            if (!call(visit, x->data)) return false;
+        return true;
     }
 
-    // 后序遍历（递归）
-    void postOrder(void (*visit)(const T&)) const {
-        postOrderRecursive(root, visit);
+    // 后序遍历（沿父指针，无栈）
+    template <typename VST>
+    bool postOrder(VST& visit) const {
+        for (TreeNode<T>* x = firstPost(root); x; x = succPost(x))
+            if (!call(visit, x->data)) return false;
+        return true;
     }
 
-    // 层次遍历
-    void levelOrder(void (*visit)(const T&)) const {
-        if (!root) return;
+    // 层次遍历（队列长度不超过树的最大宽度）
+    template <typename VST>
+    bool levelOrder(VST& visit) const {
+        if (!root) return true;
         
         std::queue<TreeNode<T>*> q;
         q.push(root);
@@ -138,80 +259,251 @@ public:
         while (!q.empty()) {
             TreeNode<T>* current = q.front();
             q.pop();
-            visit(current->data);
+            if (!call(visit, current->data)) return false;
             
             if (current->left) q.push(current->left);
             if (current->right) q.push(current->right);
         }
+        return true;
     }
 
-    // 前序遍历（迭代）
-    void preOrderIterative(void (*visit)(const T&)) const {
-        if (!root) return;
-        
-        std::stack<TreeNode<T>*> s;
-        s.push(root);
-        
-        while (!s.empty()) {
-            TreeNode<T>* current = s.top();
-            s.pop();
-            visit(current->data);
-            
-            if (current->right) s.push(current->right);
-            if (current->left) s.push(current->left);
+    // 以下Morris遍历不依赖父指针：借用空闲的右指针临时线索化，遍历结束后恢复原状
+    // 遍历期间树结构被临时修改，不可与其他读者并发；提前结束时仍需走完全程以拆除线索
+
+    // 前序遍历（Morris，O(1)辅助空间）
+    template <typename VST>
+    bool preOrderIterative(VST& visit) const {
+        bool go = true;
+        TreeNode<T>* current = root;
+        while (current) {
+            if (!current->left) {
+                if (go) go = call(visit, current->data);
+                current = current->right;
+                continue;
+            }
+            TreeNode<T>* pred = current->left;
+            while (pred->right && pred->right != current) pred = pred->right;
+            if (!pred->right) {
+                if (go) go = call(visit, current->data);
+                pred->right = current;  // 建立线索
+                current = current->left;
+            } else {
+                pred->right = nullptr;  // 拆除线索
+                current = current->right;
+            }
         }
+        return go;
     }
 
-    // 中序遍历（迭代）
-    void inOrderIterative(void (*visit)(const T&)) const {
-        std::stack<TreeNode<T>*> s;
+    // 中序遍历（Morris，O(1)辅助空间）
+    template <typename VST>
+    bool inOrderIterative(VST& visit) const {
+        bool go = true;
         TreeNode<T>* current = root;
-        
-        while (current || !s.empty()) {
-            while (current) {
-                s.push(current);
+        while (current) {
+            if (!current->left) {
+                if (go) go = call(visit, current->data);
+                current = current->right;
+                continue;
+            }
+            TreeNode<T>* pred = current->left;
+            while (pred->right && pred->right != current) pred = pred->right;
+            if (!pred->right) {
+                pred->right = current;
                 current = current->left;
+            } else {
+                pred->right = nullptr;
+                if (go) go = call(visit, current->data);
+                current = current->right;
             }
-            
-            current = s.top();
-            s.pop();
-            visit(current->data);
-            current = current->right;
         }
+        return go;
     }
 
-    // 后序遍历（迭代）
-    void postOrderIterative(void (*visit)(const T&)) const {
-        if (!root) return;
-        
-        std::stack<TreeNode<T>*> s1, s2;
-        s1.push(root);
-        
-        while (!s1.empty()) {
-            TreeNode<T>* current = s1.top();
-            s1.pop();
-            s2.push(current);
-            
-            if (current->left) s1.push(current->left);
-            if (current->right) s1.push(current->right);
+    // 后序遍历（Morris，O(1)辅助空间）：拆除线索时逆序访问左子树的右链
+    template <typename VST>
+    bool postOrderIterative(VST& visit) const {
+        bool go = true;
+        TreeNode<T>* current = root;
+        while (current) {
+            if (!current->left) {
+                current = current->right;
+                continue;
+            }
+            TreeNode<T>* pred = current->left;
+            while (pred->right && pred->right != current) pred = pred->right;
+            if (!pred->right) {
+                pred->right = current;
+                current = current->left;
+            } else {
+                pred->right = nullptr;
+                visitRightReverse(current->left, pred, visit, go);
+                current = current->right;
+            }
         }
-        
-        while (!s2.empty()) {
-            TreeNode<T>* current = s2.top();
-            s2.pop();
-            visit(current->data);
+        if (root) visitRightReverse(root, lastIn(root), visit, go);
+        return go;
+    }
+
+    // 中序双向迭代器：沿父指针求前驱、后继，无辅助栈；end()为空指针
+    class iterator {
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        iterator(TreeNode<T>* node = nullptr, const BinaryTree<T>* tree = nullptr)
+            : _node(node), _tree(tree) {}
+        TreeNode<T>* node() const { return _node; }
+        const T& operator*() const { return _node->data; }
+        const T* operator->() const { return &_node->data; }
+        iterator& operator++() { _node = succIn(_node); return *this; }
+        iterator operator++(int) { iterator old = *this; ++*this; return old; }
+        iterator& operator--() {
+            _node = _node ? predIn(_node) : lastIn(_tree->root);
+            return *this;
+        }
+        iterator operator--(int) { iterator old = *this; --*this; return old; }
+        bool operator==(const iterator& o) const { return _node == o._node; }
+        bool operator!=(const iterator& o) const { return _node != o._node; }
+    private:
+        TreeNode<T>* _node;
+        const BinaryTree<T>* _tree;  // 自end()回退时定位最右节点
+    };
+    typedef iterator const_iterator;
+
+    // 沿父指针的前向迭代器，Succ为直接后继函数（前序、后序共用）
+    template <TreeNode<T>* (*Succ)(TreeNode<T>*)>
+    class walk_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        walk_iterator(TreeNode<T>* node = nullptr) : _node(node) {}
+        TreeNode<T>* node() const { return _node; }
+        const T& operator*() const { return _node->data; }
+        const T* operator->() const { return &_node->data; }
+        walk_iterator& operator++() { _node = Succ(_node); return *this; }
+        walk_iterator operator++(int) { walk_iterator old = *this; ++*this; return old; }
+        bool operator==(const walk_iterator& o) const { return _node == o._node; }
+        bool operator!=(const walk_iterator& o) const { return _node != o._node; }
+    private:
+        TreeNode<T>* _node;
+    };
+    typedef walk_iterator<&BinaryTree<T>::succPre> pre_iterator;
+    typedef walk_iterator<&BinaryTree<T>::succPost> post_iterator;
+
+    // 层次迭代器：内含待访问队列，复制迭代器会复制队列
+    class level_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        level_iterator(TreeNode<T>* node = nullptr) {
+            if (node) _q.push(node);
+        }
+        TreeNode<T>* node() const { return _q.empty() ? nullptr : _q.front(); }
+        const T& operator*() const { return _q.front()->data; }
+        const T* operator->() const { return &_q.front()->data; }
+        level_iterator& operator++() {
+            TreeNode<T>* x = _q.front();
+            _q.pop();
+            if (x->left) _q.push(x->left);
+            if (x->right) _q.push(x->right);
+            return *this;
         }
+        bool operator==(const level_iterator& o) const { return node() == o.node(); }
+        bool operator!=(const level_iterator& o) const { return node() != o.node(); }
+    private:
+        std::queue<TreeNode<T>*> _q;
+    };
+
+    // 迭代区间，供range-for使用
+    template <typename It>
+    struct View {
+        It first, last;
+        It begin() const { return first; }
+        It end() const { return last; }
+    };
+
+    // 中序区间，for (const T& e : tree) 按升序访问
+    iterator begin() const { return iterator(firstIn(root), this); }
+    iterator end() const { return iterator(nullptr, this); }
+
+    View<pre_iterator> preOrderView() const {
+        View<pre_iterator> v = { pre_iterator(root), pre_iterator() };
+        return v;
+    }
+
+    View<post_iterator> postOrderView() const {
+        View<post_iterator> v = { post_iterator(firstPost(root)), post_iterator() };
+        return v;
+    }
+
+    View<level_iterator> levelOrderView() const {
+        View<level_iterator> v = { level_iterator(root), level_iterator() };
+        return v;
     }
 
-    // 获取节点的深度
+    // 获取节点的深度（重新计算）：在子树内沿父指针做前序游走，记录所在层次
     int depth(TreeNode<T>* node) const {
         if (!node) return -1;
-        return 1 + std::max(depth(node->left), depth(node->right));
+        int h = 0, level = 0;
+        TreeNode<T>* x = node;
+        while (true) {
+            if (x->left) {
+                x = x->left;
+                level++;
+            } else if (x->right) {
+                x = x->right;
+                level++;
+            } else {
+                h = std::max(h, level);
+                while (x != node && (x == x->parent->right || !x->parent->right)) {
+                    x = x->parent;
+                    level--;
+                }
+                if (x == node) break;
+                x = x->parent->right;
+            }
+        }
+        return h;
     }
 
-    // 获取树的深度
+    // 获取树的深度（读取根节点维护的高度，O(1)）
     int depth() const {
-        return depth(root);
+        return stature(root);
+    }
+
+    // 节点高度，空树为-1
+    static int stature(const TreeNode<T>* node) {
+        return node ? node->height : -1;
+    }
+
+    // 子树规模，空树为0
+    static int sizeOf(const TreeNode<T>* node) {
+        return node ? node->size : 0;
+    }
+
+protected:
+    // 由孩子重新计算节点的高度、子树规模及增广值
+    static void update(TreeNode<T>* node) {
+        node->height = 1 + std::max(stature(node->left), stature(node->right));
+        node->size = 1 + sizeOf(node->left) + sizeOf(node->right);
+        TreeAugment<T>::pull(node);
+    }
+
+    // 自node起向上更新全部祖先（子树规模每层都会变化，不能提前结束）
+    static void updateAbove(TreeNode<T>* node) {
+        for (; node; node = node->parent) update(node);
     }
 };
 
@@ -221,30 +513,264 @@ class BST : public BinaryTree<T> {
 public:
     // 查找元素
     TreeNode<T>* search(const T& val) const {
+        TreeNode<T>* hot;
+        return searchIn(val, hot);
+    }
+
+    // 插入元素（虚函数：AVL、Splay各自重新平衡，批量操作经由基类调用时也不例外）
+    virtual TreeNode<T>* insert(const T& val) {
+        TreeNode<T>* parent;
+        if (searchIn(val, parent)) return nullptr;  // 不允许重复元素
+        TreeNode<T>* newNode = attach(val, parent);
+        this->updateAbove(parent);
+        return newNode;
+    }
+
+    // 删除元素
+    virtual bool remove(const T& val) {
+        TreeNode<T>* node = search(val);
+        if (!node) return false;
+        
+        this->updateAbove(removeAt(node));
+        return true;
+    }
+
+    // 秩为k（自0起）的元素，即第k+1小者，越界时返回nullptr，O(h)
+    TreeNode<T>* select(int k) const {
+        if (k < 0 || k >= this->size) return nullptr;
+        TreeNode<T>* x = this->root;
+        while (true) {
+            int l = this->sizeOf(x->left);
+            if (k < l) {
+                x = x->left;
+            } else if (k == l) {
+                return x;
+            } else {
+                k -= l + 1;
+                x = x->right;
+            }
+        }
+    }
+
+    // 小于val的元素个数，O(h)
+    int rank(const T& val) const {
+        return countBelow(val, false);
+    }
+
+    // 落在闭区间[lo, hi]内的元素个数，O(h)
+    int count_range(const T& lo, const T& hi) const {
+        if (hi < lo) return 0;
+        return countBelow(hi, true) - countBelow(lo, false);
+    }
+
+    // 第一个不小于val的元素，不存在时返回nullptr，O(h)
+    TreeNode<T>* lower_bound(const T& val) const {
+        return firstAbove(val, false);
+    }
+
+    // 第一个大于val的元素，不存在时返回nullptr，O(h)
+    TreeNode<T>* upper_bound(const T& val) const {
+        return firstAbove(val, true);
+    }
+
+    // 不小于val的最小元素（同lower_bound）
+    TreeNode<T>* ceiling(const T& val) const {
+        return firstAbove(val, false);
+    }
+
+    // 不大于val的最大元素，不存在时返回nullptr，O(h)
+    TreeNode<T>* floor(const T& val) const {
+        TreeNode<T>* x = this->root;
+        TreeNode<T>* best = nullptr;
+        while (x) {
+            if (val < x->data) {
+                x = x->left;
+            } else {
+                best = x;
+                if (val == x->data) break;
+                x = x->right;
+            }
+        }
+        return best;
+    }
+
+    // 中序直接后继、直接前驱（沿父指针），不存在时返回nullptr，均摊O(1)
+    static TreeNode<T>* successor(TreeNode<T>* x) {
+        return BinaryTree<T>::succIn(x);
+    }
+
+    static TreeNode<T>* predecessor(TreeNode<T>* x) {
+        return BinaryTree<T>::predIn(x);
+    }
+
+    // 按升序访问[lo, hi]内的元素，O(h + k)；访问器返回false时提前结束
+    template <typename VST>
+    bool range(const T& lo, const T& hi, VST& visit) const {
+        for (TreeNode<T>* x = lower_bound(lo); x && !(hi < x->data); x = BinaryTree<T>::succIn(x))
+            if (!BinaryTree<T>::call(visit, x->data)) return false;
+        return true;
+    }
+
+    // [lo, hi]内元素的迭代区间，供range-for使用
+    typename BinaryTree<T>::template View<typename BinaryTree<T>::iterator> range(const T& lo, const T& hi) const {
+        typedef typename BinaryTree<T>::iterator It;
+        typename BinaryTree<T>::template View<It> v = { It(lower_bound(lo), this), It(hi < lo ? lower_bound(lo) : upper_bound(hi), this) };
+        return v;
+    }
+
+    // 由严格递增的序列（Vector、std::vector等支持size()与[]者）构建完全平衡的树（取中点为根），
+    // O(n)，原有元素被清除
+    template <typename Seq>
+    void build_from_sorted(const Seq& sorted) {
+        this->clear();
+        int n = (int)sorted.size();
+        for (int i = 1; i < n; ++i)
+            assert(sorted[i - 1] < sorted[i] && "build_from_sorted: input not strictly increasing!");
+        this->pool.reserve(n);
+        this->root = buildRange(sorted, 0, n, nullptr);
+        this->size = n;
+    }
+
+    // 以下集合运算与批量操作均为“展平-归并-重建”，O(m + n)，结果为完全平衡的树
+    // 重建会释放全部旧节点：此前取得的TreeNode*与迭代器一律失效（批量规模较小时除外，见insert_sorted）
+
+    // 并集：this = this ∪ other
+    void set_union(const BST<T>& other) {
+        Vector<T> a = flatten(), b = other.flatten(), c(a.size() + b.size());
+        int i = 0, j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a[i] < b[j]) c.push_back(a[i++]);
+            else if (b[j] < a[i]) c.push_back(b[j++]);
+            else { c.push_back(a[i++]); j++; }
+        }
+        while (i < a.size()) c.push_back(a[i++]);
+        while (j < b.size()) c.push_back(b[j++]);
+        build_from_sorted(c);
+    }
+
+    // 交集：this = this ∩ other
+    void set_intersection(const BST<T>& other) {
+        Vector<T> a = flatten(), b = other.flatten(), c(std::min(a.size(), b.size()));
+        int i = 0, j = 0;
+        while (i < a.size() && j < b.size()) {
+            if (a[i] < b[j]) i++;
+            else if (b[j] < a[i]) j++;
+            else { c.push_back(a[i++]); j++; }
+        }
+        build_from_sorted(c);
+    }
+
+    // 差集：this = this - other
+    void set_difference(const BST<T>& other) {
+        Vector<T> b = other.flatten();
+        erase_sorted(b);
+    }
+
+    // 批量插入一组非降序元素（重复者忽略）
+    // k·log n < n 时逐个insert，O(k log n)，原有节点不受影响；否则展平-归并-重建，O(n + k)
+    void insert_sorted(const Vector<T>& batch) {
+        if (smallBatch(batch.size())) {
+            for (int i = 0; i < batch.size(); ++i) this->insert(batch[i]);
+            return;
+        }
+        Vector<T> a = flatten(), c(a.size() + batch.size());
+        int i = 0, j = 0;
+        while (i < a.size() || j < batch.size()) {
+            const T& e = (j == batch.size() || (i < a.size() && a[i] < batch[j])) ? a[i++] : batch[j++];
+            if (c.empty() || c[c.size() - 1] < e) c.push_back(e);
+        }
+        build_from_sorted(c);
+    }
+
+    // 批量删除一组非降序元素（不存在者忽略），规模阈值同insert_sorted
+    void erase_sorted(const Vector<T>& batch) {
+        if (smallBatch(batch.size())) {
+            for (int i = 0; i < batch.size(); ++i) this->remove(batch[i]);
+            return;
+        }
+        Vector<T> a = flatten(), c(a.size());
+        int j = 0;
+        for (int i = 0; i < a.size(); ++i) {
+            while (j < batch.size() && batch[j] < a[i]) j++;
+            if (j < batch.size() && !(a[i] < batch[j])) continue;  // a[i]在batch中
+            c.push_back(a[i]);
+        }
+        build_from_sorted(c);
+    }
+
+    // 按中序（升序）展平到Vector
+    Vector<T> flatten() const {
+        Vector<T> v(this->size);
+        for (typename BinaryTree<T>::iterator it = this->begin(); it != this->end(); ++it) v.push_back(*it);
+        return v;
+    }
+
+protected:
+    // 批量规模k是否满足k·log2(n) < n，此时逐个更新比整体重建便宜
+    bool smallBatch(int k) const {
+        int lg = 1;
+        while ((1 << lg) <= this->size && lg < 30) lg++;
+        return (long long)k * lg < this->size;
+    }
+
+    // 第一个大于（strict为false时为不小于）val的元素
+    TreeNode<T>* firstAbove(const T& val, bool strict) const {
+        TreeNode<T>* x = this->root;
+        TreeNode<T>* best = nullptr;
+        while (x) {
+            if (val < x->data || (!strict && val == x->data)) {
+                best = x;
+                x = x->left;
+            } else {
+                x = x->right;
+            }
+        }
+        return best;
+    }
+
+    // 小于（inclusive时为不大于）val的元素个数
+    int countBelow(const T& val, bool inclusive) const {
+        int n = 0;
+        TreeNode<T>* x = this->root;
+        while (x) {
+            if (val < x->data || (!inclusive && val == x->data)) {
+                x = x->left;
+            } else {
+                n += this->sizeOf(x->left) + 1;
+                x = x->right;
+            }
+        }
+        return n;
+    }
+
+    // 以sorted[lo, hi)的中点为根建立子树，递归深度为O(log n)
+    template <typename Seq>
+    TreeNode<T>* buildRange(const Seq& sorted, int lo, int hi, TreeNode<T>* parent) {
+        if (lo >= hi) return nullptr;
+        int mi = lo + (hi - lo) / 2;
+        TreeNode<T>* x = this->pool.create(sorted[mi], parent);
+        x->left = buildRange(sorted, lo, mi, x);
+        x->right = buildRange(sorted, mi + 1, hi, x);
+        this->update(x);
+        return x;
+    }
+
+    // 查找val：返回命中节点（未命中为nullptr），hot为命中节点的父亲（未命中时为应插入位置的父亲）
+    TreeNode<T>* searchIn(const T& val, TreeNode<T>*& hot) const {
+        hot = nullptr;
         TreeNode<T>* current = this->root;
         while (current) {
             if (val == current->data) return current;
-            else if (val < current->data) current = current->left;
-            else current = current->right;
+            hot = current;
+            current = (val < current->data) ? current->left : current->right;
         }
         return nullptr;
     }
 
-    // 插入元素
-    TreeNode<T>* insert(const T& val) {
-        TreeNode<T>* parent = nullptr;
-        TreeNode<T>* current = this->root;
-        
-        // 查找插入位置
-        while (current) {
-            parent = current;
-            if (val == current->data) return nullptr;  // 不允许重复元素
-            else if (val < current->data) current = current->left;
-            else current = current->right;
-        }
-        
-        // 创建新节点
-        TreeNode<T>* newNode = new TreeNode<T>(val, parent);
+    // 在parent之下创建新叶节点（parent为空时作为根）
+    TreeNode<T>* attach(const T& val, TreeNode<T>* parent) {
+        TreeNode<T>* newNode = this->pool.create(val, parent);
+        this->update(newNode);
         if (!parent) this->root = newNode;  // 树为空
         else if (val < parent->data) parent->left = newNode;
         else parent->right = newNode;
@@ -253,20 +779,14 @@ public:
         return newNode;
     }
 
-    // 删除元素
-    bool remove(const T& val) {
-        TreeNode<T>* node = search(val);
-        if (!node) return false;
-        
-        removeNode(node);
-        return true;
+    // 父节点中指向node的指针（node为根时是root）
+    TreeNode<T>*& fromParentTo(TreeNode<T>* node) {
+        if (!node->parent) return this->root;
+        return (node == node->parent->left) ? node->parent->left : node->parent->right;
     }
 
-private:
-    // 删除指定节点
-    void removeNode(TreeNode<T>* node) {
-        if (!node) return;
-        
+    // 删除指定节点，返回实际被删除节点的父亲
+    TreeNode<T>* removeAt(TreeNode<T>* node) {
         // 情况1：节点有两个子节点
         if (node->left && node->right) {
             // 找到中序后继（右子树的最左节点）
@@ -284,26 +804,53 @@ private:
         
         // 情况2：节点最多有一个子节点
         TreeNode<T>* child = (node->left) ? node->left : node->right;
+        TreeNode<T>* hot = node->parent;
         
         if (child) {
-            child->parent = node->parent;  // 更新子节点的父指针
+            child->parent = hot;  // 更新子节点的父指针
         }
         
-        // 更新父节点的子指针
-        if (node->parent) {
-            if (node == node->parent->left) {
-                node->parent->left = child;
-            } else {
-                node->parent->right = child;
-            }
-        } else {
-            // 如果是根节点
-            this->root = child;
-        }
+        // 更新父节点的子指针（如果是根节点则更新root）
+        fromParentTo(node) = child;
         
         // 删除节点
-        delete node;
+        this->pool.destroy(node);
         this->size--;
+        return hot;
+    }
+
+    // "3 + 4"重构：按中序a < b < c接成以b为根的子树，返回b
+    TreeNode<T>* connect34(TreeNode<T>* a, TreeNode<T>* b, TreeNode<T>* c,
+                           TreeNode<T>* t0, TreeNode<T>* t1, TreeNode<T>* t2, TreeNode<T>* t3) {
+        a->left = t0; if (t0) t0->parent = a;
+        a->right = t1; if (t1) t1->parent = a;
+        this->update(a);
+        c->left = t2; if (t2) t2->parent = c;
+        c->right = t3; if (t3) t3->parent = c;
+        this->update(c);
+        b->left = a; a->parent = b;
+        b->right = c; c->parent = b;
+        this->update(b);
+        return b;
+    }
+
+    // 对孙辈节点v、父亲p、祖父g做单旋或双旋，返回新子树根（已接入原祖父的位置）
+    TreeNode<T>* rotateAt(TreeNode<T>* v) {
+        TreeNode<T>* p = v->parent;
+        TreeNode<T>* g = p->parent;
+        TreeNode<T>* gp = g->parent;
+        TreeNode<T>*& link = fromParentTo(g);
+        TreeNode<T>* r;
+        if (p == g->left) {
+            if (v == p->left) r = connect34(v, p, g, v->left, v->right, p->right, g->right);
+            else r = connect34(p, v, g, p->left, v->left, v->right, g->right);
+        } else {
+            if (v == p->right) r = connect34(g, p, v, g->left, p->left, v->left, v->right);
+            else r = connect34(g, v, p, g->left, v->left, v->right, p->right);
+        }
+        link = r;
+        r->parent = gp;
+        return r;
     }
 };
 
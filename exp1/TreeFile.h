@@ -0,0 +1,361 @@
+#ifndef TREE_FILE_H
+#define TREE_FILE_H
+
+#include "AVL.h"
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// 树文件头：其后紧跟 count 个关键码；STRUCTURE 格式再跟一个结构位图
+// （每个节点2位，按前序排列：bit0 有左孩子，bit1 有右孩子）
+struct TreeFileHeader {
+    char magic[4];      // "DSTF"
+    uint32_t version;   // 格式版本
+    uint32_t elemSize;  // sizeof(T)
+    uint32_t kind;      // STRUCTURE 或 SORTED
+    uint64_t count;     // 关键码数
+};
+
+const uint32_t TREE_FILE_VERSION = 1;  // 当前格式版本
+
+enum TreeFileKind {
+    TREE_FILE_STRUCTURE = 0,  // 前序关键码 + 结构位图，可还原任意二叉树的原形
+    TREE_FILE_SORTED = 1      // 升序关键码，重建为平衡BST，也可映射后直接查询
+};
+
+// 二叉树的紧凑二进制存储：关键码按原样写出，T 须可平凡复制（不含指针等）
+// 加载为 O(n)：节点一次性从节点池预留，顺序读入时直接链接，无需逐个 insert。
+// 读写失败、文件损坏，或还原到BST/AVL时关键码次序、平衡条件不符，均返回 false，树被清空。
+template <typename T>
+class TreeFile {
+private:
+    typedef TreeNode<T> Node;
+    static const int CHUNK = sizeof(T) < 16384 ? 16384 / (int)sizeof(T) : 1;  // 读写缓冲（16KB）的关键码数
+
+    static_assert(std::is_trivially_copyable<T>::value, "TreeFile requires a trivially copyable key type");
+
+    static bool writeHeader(FILE* f, uint32_t kind, uint64_t count) {
+        TreeFileHeader h;
+        memcpy(h.magic, "DSTF", 4);
+        h.version = TREE_FILE_VERSION;
+        h.elemSize = sizeof(T);
+        h.kind = kind;
+        h.count = count;
+        return fwrite(&h, sizeof(h), 1, f) == 1;
+    }
+
+    // 结构位图的字节数
+    static size_t shapeBytes(uint64_t count) {
+        return (size_t)((2 * count + 7) / 8);
+    }
+
+    // 读入并校验文件头；count须与文件实际长度相符，以免按损坏的count分配内存
+    static bool readHeader(FILE* f, uint32_t kind, uint64_t& count) {
+        if (fseek(f, 0, SEEK_END) != 0) return false;
+        long length = ftell(f);
+        if (length < (long)sizeof(TreeFileHeader) || fseek(f, 0, SEEK_SET) != 0) return false;
+        TreeFileHeader h;
+        if (fread(&h, sizeof(h), 1, f) != 1) return false;
+        if (memcmp(h.magic, "DSTF", 4) != 0 || h.version != TREE_FILE_VERSION || h.elemSize != sizeof(T) || h.kind != kind)
+            return false;
+        uint64_t payload = (uint64_t)length - sizeof(h);
+        if (h.count > payload / sizeof(T) || h.count >= 0x7FFFFFFF) return false;
+        if (kind == TREE_FILE_STRUCTURE && h.count * sizeof(T) + shapeBytes(h.count) > payload) return false;
+        count = h.count;
+        return true;
+    }
+
+    // 按块写出一串关键码
+    template <typename It>
+    static bool writeKeys(FILE* f, It first, It last) {
+        T buf[CHUNK];
+        int n = 0;
+        for (; first != last; ++first) {
+            buf[n++] = *first;
+            if (n == CHUNK) {
+                if (fwrite(buf, sizeof(T), n, f) != (size_t)n) return false;
+                n = 0;
+            }
+        }
+        return n == 0 || fwrite(buf, sizeof(T), n, f) == (size_t)n;
+    }
+
+public:
+    // 按结构保存：前序关键码 + 结构位图
+    static bool save(const BinaryTree<T>& tree, const char* path) {
+        FILE* f = fopen(path, "wb");
+        if (!f) return false;
+        typename BinaryTree<T>::template View<typename BinaryTree<T>::pre_iterator> pre = tree.preOrderView();
+        bool ok = writeHeader(f, TREE_FILE_STRUCTURE, tree.getSize()) && writeKeys(f, pre.begin(), pre.end());
+        unsigned char byte = 0;
+        int bits = 0;
+        for (typename BinaryTree<T>::pre_iterator it = pre.begin(); ok && it != pre.end(); ++it) {
+            Node* x = it.node();
+            byte |= (unsigned char)(((x->left ? 1 : 0) | (x->right ? 2 : 0)) << bits);
+            bits += 2;
+            if (bits == 8) {
+                ok = fputc(byte, f) != EOF;
+                byte = 0;
+                bits = 0;
+            }
+        }
+        if (ok && bits) ok = fputc(byte, f) != EOF;
+        return fclose(f) == 0 && ok;
+    }
+
+    // 还原按结构保存的树，O(n)；一般二叉树不检查关键码次序
+    static bool load(BinaryTree<T>& tree, const char* path) {
+        return loadAs(tree, path, 0);
+    }
+
+    // 还原到BST（含Splay）：中序须严格递增，否则视为损坏
+    static bool load(BST<T>& tree, const char* path) {
+        return loadAs(tree, path, CHECK_ORDER);
+    }
+
+    // 还原到AVL：另须每个节点都满足AVL平衡条件
+    static bool load(AVL<T>& tree, const char* path) {
+        return loadAs(tree, path, CHECK_ORDER | CHECK_BALANCE);
+    }
+
+    // 按升序保存BST的关键码
+    static bool saveSorted(const BST<T>& tree, const char* path) {
+        FILE* f = fopen(path, "wb");
+        if (!f) return false;
+        bool ok = writeHeader(f, TREE_FILE_SORTED, tree.getSize()) && writeKeys(f, tree.begin(), tree.end());
+        return fclose(f) == 0 && ok;
+    }
+
+    // 读入升序关键码并重建为完全平衡的BST，O(n)
+    static bool loadSorted(BST<T>& tree, const char* path) {
+        tree.clear();
+        FILE* f = fopen(path, "rb");
+        if (!f) return false;
+        uint64_t count;
+        bool ok = readHeader(f, TREE_FILE_SORTED, count);
+        int n = ok ? (int)count : 0;
+        std::vector<T> sorted;
+        sorted.reserve(n);
+        T buf[CHUNK];
+        for (int done = 0; ok && done < n; ) {
+            int m = n - done < CHUNK ? n - done : CHUNK;
+            ok = fread(buf, sizeof(T), m, f) == (size_t)m;
+            for (int i = 0; ok && i < m; ++i) {
+                ok = sorted.empty() || sorted.back() < buf[i];  // 必须严格递增
+                sorted.push_back(buf[i]);
+            }
+            done += m;
+        }
+        fclose(f);
+        if (ok) tree.build_from_sorted(sorted);
+        return ok;
+    }
+
+private:
+    enum { CHECK_ORDER = 1, CHECK_BALANCE = 2 };
+
+    // 读入结构文件并建树，再按checks校验；失败时树被清空
+    static bool loadAs(BinaryTree<T>& tree, const char* path, int checks) {
+        tree.clear();
+        FILE* f = fopen(path, "rb");
+        if (!f) return false;
+        uint64_t count;
+        bool ok = readHeader(f, TREE_FILE_STRUCTURE, count);
+        int n = ok ? (int)count : 0;
+        size_t bytes = shapeBytes(n);
+        T* keys = new T[n > 0 ? n : 1];
+        unsigned char* shape = new unsigned char[bytes + 1];
+        ok = ok && fread(keys, sizeof(T), n, f) == (size_t)n && fread(shape, 1, bytes, f) == bytes;
+        fclose(f);
+        if (ok) ok = build(tree, keys, shape, n) && valid(tree, checks);
+        delete[] keys;
+        delete[] shape;
+        if (!ok) tree.clear();
+        return ok;
+    }
+
+    // 校验建成的树，O(n)：CHECK_ORDER要求中序严格递增，CHECK_BALANCE要求各节点左右子树高度差不超过1
+    static bool valid(const BinaryTree<T>& tree, int checks) {
+        if (checks & CHECK_ORDER) {
+            const T* prev = nullptr;
+            for (typename BinaryTree<T>::iterator it = tree.begin(); it != tree.end(); ++it) {
+                if (prev && !(*prev < *it)) return false;
+                prev = &*it;
+            }
+        }
+        if (checks & CHECK_BALANCE) {
+            typename BinaryTree<T>::template View<typename BinaryTree<T>::pre_iterator> pre = tree.preOrderView();
+            for (typename BinaryTree<T>::pre_iterator it = pre.begin(); it != pre.end(); ++it) {
+                Node* x = it.node();
+                int bf = BinaryTree<T>::stature(x->left) - BinaryTree<T>::stature(x->right);
+                if (bf < -1 || bf > 1) return false;
+            }
+        }
+        return true;
+    }
+
+    // 按前序关键码与结构位图逐个创建节点；高度字段暂存该节点的结构位，子树完成时由update覆盖
+    static bool build(BinaryTree<T>& tree, const T* keys, const unsigned char* shape, int n) {
+        if (n == 0) return true;
+        tree.pool.reserve(n);
+        tree.size = n;
+        Node* parent = nullptr;
+        bool asLeft = false;
+        for (int i = 0; i < n; ++i) {
+            if (i > 0 && !parent) return false;  // 结构位图与关键码数不符
+            Node* x = tree.pool.create(keys[i], parent);
+            if (!parent) tree.root = x;
+            else if (asLeft) parent->left = x;
+            else parent->right = x;
+            x->height = (shape[i / 4] >> (i % 4 * 2)) & 3;
+            if (x->height & 1) {
+                parent = x;
+                asLeft = true;
+                continue;
+            }
+            if (x->height & 2) {
+                parent = x;
+                asLeft = false;
+                continue;
+            }
+            // 叶节点：向上完成各祖先，直到某个祖先还欠一个右孩子
+            BinaryTree<T>::update(x);
+            parent = nullptr;
+            while (x->parent) {
+                Node* p = x->parent;
+                if (x == p->left && (p->height & 2)) {
+                    parent = p;
+                    asLeft = false;
+                    break;
+                }
+                BinaryTree<T>::update(p);
+                x = p;
+            }
+        }
+        return !parent;
+    }
+};
+
+// 映射方式查询 SORTED 格式的树文件：不创建任何节点，直接在映射的升序数组上二分查找
+// 打开只需映射文件（O(1)），查询按需从页缓存读入；Windows 下退化为整体读入内存。
+template <typename T>
+class MappedTree {
+private:
+    const T* _keys;  // 关键码数组
+    int _size;       // 关键码数
+#ifdef _WIN32
+    std::vector<char> _buffer;
+#else
+    void* _map;      // 映射区
+    size_t _length;  // 映射长度
+#endif
+
+public:
+#ifdef _WIN32
+    MappedTree() : _keys(nullptr), _size(0) {}
+#else
+    MappedTree() : _keys(nullptr), _size(0), _map(nullptr), _length(0) {}
+#endif
+
+    ~MappedTree() {
+        close();
+    }
+
+    MappedTree(const MappedTree&) = delete;
+    MappedTree& operator=(const MappedTree&) = delete;
+
+    // 打开 SORTED 格式的树文件
+    bool open(const char* path) {
+        close();
+#ifdef _WIN32
+        FILE* f = fopen(path, "rb");
+        if (!f) return false;
+        fseek(f, 0, SEEK_END);
+        long length = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        _buffer.resize(length > 0 ? length : 0);
+        bool ok = length >= (long)sizeof(TreeFileHeader) && fread(&_buffer[0], 1, length, f) == (size_t)length;
+        fclose(f);
+        if (!ok) return false;
+        const char* base = &_buffer[0];
+        size_t size = length;
+#else
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(TreeFileHeader)) {
+            ::close(fd);
+            return false;
+        }
+        _length = st.st_size;
+        _map = mmap(nullptr, _length, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (_map == MAP_FAILED) {
+            _map = nullptr;
+            return false;
+        }
+        const char* base = (const char*)_map;
+        size_t size = _length;
+#endif
+        TreeFileHeader h;
+        memcpy(&h, base, sizeof(h));
+        if (memcmp(h.magic, "DSTF", 4) != 0 || h.version != TREE_FILE_VERSION || h.elemSize != sizeof(T) || h.kind != TREE_FILE_SORTED
+            || h.count > (size - sizeof(h)) / sizeof(T)) {
+            close();
+            return false;
+        }
+        _keys = (const T*)(base + sizeof(h));
+        _size = (int)h.count;
+        return true;
+    }
+
+    void close() {
+#ifdef _WIN32
+        _buffer.clear();
+#else
+        if (_map) munmap(_map, _length);
+        _map = nullptr;
+        _length = 0;
+#endif
+        _keys = nullptr;
+        _size = 0;
+    }
+
+    int getSize() const { return _size; }
+    bool empty() const { return _size == 0; }
+    const T& operator[](int r) const { return _keys[r]; }
+
+    // 第一个不小于val的关键码的秩（不存在时为size）
+    int lower_bound(const T& val) const {
+        int lo = 0, hi = _size;
+        while (lo < hi) {
+            int mi = lo + (hi - lo) / 2;
+            if (_keys[mi] < val) lo = mi + 1;
+            else hi = mi;
+        }
+        return lo;
+    }
+
+    // 查找元素，不存在时返回nullptr
+    const T* search(const T& val) const {
+        int r = lower_bound(val);
+        return (r < _size && !(val < _keys[r])) ? &_keys[r] : nullptr;
+    }
+
+    // 按升序访问[lo, hi]内的关键码
+    template <typename VST>
+    void range(const T& lo, const T& hi, VST& visit) const {
+        for (int r = lower_bound(lo); r < _size && !(hi < _keys[r]); ++r) visit(_keys[r]);
+    }
+};
+
+#endif // TREE_FILE_H
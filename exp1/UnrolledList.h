@@ -0,0 +1,316 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include "NodePool.h"
+#include "Vector.h"
+#include <cassert>
+
+// 展开链表节点：每个节点存放一小段连续元素，节点大小约为 4 个缓存行
+template <typename T>
+struct UnrolledNode {
+    static const int CAPACITY = (256 - 2 * (int)sizeof(void*) - (int)sizeof(int)) / (int)sizeof(T) > 4
+                                ? (256 - 2 * (int)sizeof(void*) - (int)sizeof(int)) / (int)sizeof(T) : 4;
+
+    UnrolledNode<T>* prev;
+    UnrolledNode<T>* next;
+    int count;           // 本节点元素数
+    T elem[CAPACITY];    // 元素
+
+    UnrolledNode() : prev(nullptr), next(nullptr), count(0) {}
+};
+
+// 展开链表：接口与 List 对应，但以秩而非节点指针定位
+// 遍历、查找时每次缓存缺失可以处理 CAPACITY 个元素；插入时节点满则对半分裂，
+// 删除后节点不足 1/4 满则与相邻节点合并。节点从 NodePool 分配。
+template <typename T>
+class UnrolledList {
+private:
+    typedef UnrolledNode<T> Node;
+    static const int CAP = Node::CAPACITY;
+
+    int _size;            // 规模
+    Node* _head;          // 首节点
+    Node* _tail;          // 末节点
+    NodePool<Node> _pool; // 节点池
+
+    // 在 x 之后新建一个空节点
+    Node* insertNodeAfter(Node* x) {
+        Node* y = _pool.create();
+        y->prev = x;
+        y->next = x ? x->next : _head;
+        if (y->next) y->next->prev = y;
+        else _tail = y;
+        if (x) x->next = y;
+        else _head = y;
+        return y;
+    }
+
+    void removeNode(Node* x) {
+        if (x->prev) x->prev->next = x->next;
+        else _head = x->next;
+        if (x->next) x->next->prev = x->prev;
+        else _tail = x->prev;
+        _pool.destroy(x);
+    }
+
+    // 定位秩 r 所在节点，off 为节点内偏移；从较近的一端开始走
+    Node* locate(int r, int& off) const {
+        Node* x;
+        if (r < _size / 2) {
+            x = _head;
+            while (r >= x->count) {
+                r -= x->count;
+                x = x->next;
+            }
+        } else {
+            x = _tail;
+            int base = _size - x->count;
+            while (r < base) {
+                x = x->prev;
+                base -= x->count;
+            }
+            r -= base;
+        }
+        off = r;
+        return x;
+    }
+
+    // 对半分裂已满的节点 x
+    void split(Node* x) {
+        Node* y = insertNodeAfter(x);
+        int half = x->count / 2;
+        for (int i = half; i < x->count; ++i) y->elem[i - half] = x->elem[i];
+        y->count = x->count - half;
+        x->count = half;
+    }
+
+    // x 过空时与后继（或前驱）合并
+    void rebalance(Node* x) {
+        if (x->count == 0) {
+            removeNode(x);
+            return;
+        }
+        if (x->count >= CAP / 4) return;
+        Node* y = x->next;
+        if (!y || x->count + y->count > CAP) {
+            y = x;
+            x = x->prev;
+            if (!x || x->count + y->count > CAP) return;
+        }
+        for (int i = 0; i < y->count; ++i) x->elem[x->count + i] = y->elem[i];
+        x->count += y->count;
+        removeNode(y);
+    }
+
+    // 在节点 x 的 off 处插入
+    void insertAt(Node* x, int off, const T& e) {
+        if (x->count == CAP) {
+            split(x);
+            if (off > x->count) {
+                off -= x->count;
+                x = x->next;
+            }
+        }
+        for (int i = x->count; i > off; --i) x->elem[i] = x->elem[i - 1];
+        x->elem[off] = e;
+        x->count++;
+        _size++;
+    }
+
+    // 删除所有节点
+    void clearNodes() {
+        while (_head) {
+            Node* x = _head;
+            _head = x->next;
+            _pool.destroy(x);
+        }
+        _tail = nullptr;
+        _size = 0;
+    }
+
+public:
+    // 前向迭代器
+    class iterator {
+    private:
+        Node* _node;
+        int _idx;
+    public:
+        iterator(Node* node = nullptr, int idx = 0) : _node(node), _idx(idx) {}
+        T& operator*() const { return _node->elem[_idx]; }
+        T* operator->() const { return &_node->elem[_idx]; }
+        iterator& operator++() {
+            if (++_idx == _node->count) {
+                _node = _node->next;
+                _idx = 0;
+            }
+            return *this;
+        }
+        bool operator==(const iterator& o) const { return _node == o._node && _idx == o._idx; }
+        bool operator!=(const iterator& o) const { return !(*this == o); }
+    };
+
+    // 构造函数
+    UnrolledList() : _size(0), _head(nullptr), _tail(nullptr) {}
+
+    UnrolledList(const UnrolledList<T>& L) : _size(0), _head(nullptr), _tail(nullptr) {
+        for (Node* x = L._head; x; x = x->next)
+            for (int i = 0; i < x->count; ++i) insertAsLast(x->elem[i]);
+    }
+
+    // 析构函数
+    ~UnrolledList() {
+        clearNodes();
+    }
+
+    UnrolledList<T>& operator=(const UnrolledList<T>& L) {
+        if (this != &L) {
+            clearNodes();
+            for (Node* x = L._head; x; x = x->next)
+                for (int i = 0; i < x->count; ++i) insertAsLast(x->elem[i]);
+        }
+        return *this;
+    }
+
+    // 只读访问接口
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    T& operator[](int r) const {
+        assert(0 <= r && r < _size);
+        int off;
+        Node* x = locate(r, off);
+        return x->elem[off];
+    }
+    iterator begin() const { return iterator(_head, 0); }
+    iterator end() const { return iterator(nullptr, 0); }
+
+    // 查找：返回最后一个等于 e 的元素的秩，不存在时返回 -1
+    int find(const T& e) const {
+        int base = _size;
+        for (Node* x = _tail; x; x = x->prev) {
+            base -= x->count;
+            for (int i = x->count - 1; i >= 0; --i)
+                if (x->elem[i] == e) return base + i;
+        }
+        return -1;
+    }
+
+    // 有序列表查找：返回不大于 e 的最后一个元素的秩，不存在时返回 -1
+    int search(const T& e) const {
+        int base = _size;
+        for (Node* x = _tail; x; x = x->prev) {
+            base -= x->count;
+            if (e < x->elem[0]) continue;
+            int i = x->count - 1;
+            while (e < x->elem[i]) --i;
+            return base + i;
+        }
+        return -1;
+    }
+
+    // 插入
+    void insertAsFirst(const T& e) {
+        if (!_head) insertNodeAfter(nullptr);
+        insertAt(_head, 0, e);
+    }
+
+    void insertAsLast(const T& e) {
+        if (!_tail) insertNodeAfter(nullptr);
+        insertAt(_tail, _tail->count, e);
+    }
+
+    // 插入使 e 的秩为 r
+    void insert(int r, const T& e) {
+        assert(0 <= r && r <= _size);
+        if (r == _size) {
+            insertAsLast(e);
+            return;
+        }
+        int off;
+        Node* x = locate(r, off);
+        insertAt(x, off, e);
+    }
+
+    // 删除秩为 r 的元素
+    T remove(int r) {
+        assert(0 <= r && r < _size);
+        int off;
+        Node* x = locate(r, off);
+        T e = x->elem[off];
+        for (int i = off; i < x->count - 1; ++i) x->elem[i] = x->elem[i + 1];
+        x->count--;
+        _size--;
+        rebalance(x);
+        return e;
+    }
+
+    // 清空
+    void clear() {
+        clearNodes();
+    }
+
+    // 唯一化（无序），O(n^2)
+    int deduplicate() {
+        int oldSize = _size;
+        for (int r = 1; r < _size; ) {
+            bool dup = false;
+            T& e = (*this)[r];
+            for (iterator it = begin(); it != end() && &*it != &e; ++it)
+                if (*it == e) { dup = true; break; }
+            if (dup) remove(r);
+            else r++;
+        }
+        return oldSize - _size;
+    }
+
+    // 唯一化（有序），O(n)：读写双指针原地压缩，最后回收多余节点
+    int uniquify() {
+        if (_size < 2) return 0;
+        int oldSize = _size;
+        Node* w = _head;  // 写位置（写位置始终不超过读位置）
+        int wi = 1;
+        T last = _head->elem[0];
+        int kept = 1;
+        for (Node* x = _head; x; x = x->next) {
+            for (int i = (x == _head ? 1 : 0); i < x->count; ++i) {
+                if (x->elem[i] == last) continue;
+                if (wi == w->count) {
+                    w = w->next;
+                    wi = 0;
+                }
+                last = x->elem[i];
+                w->elem[wi++] = last;
+                kept++;
+            }
+        }
+        w->count = wi;
+        while (w->next) removeNode(w->next);
+        _size = kept;
+        return oldSize - _size;
+    }
+
+    // 遍历
+    void traverse(void (*visit)(T&)) {
+        for (Node* x = _head; x; x = x->next)
+            for (int i = 0; i < x->count; ++i) visit(x->elem[i]);
+    }
+
+    template <typename VST>
+    void traverse(VST& visit) {
+        for (Node* x = _head; x; x = x->next)
+            for (int i = 0; i < x->count; ++i) visit(x->elem[i]);
+    }
+
+    // 排序（稳定）：元素复制到 Vector 中归并排序后写回
+    void sort() {
+        if (_size < 2) return;
+        Vector<T> v(_size);
+        for (Node* x = _head; x; x = x->next)
+            for (int i = 0; i < x->count; ++i) v.push_back(x->elem[i]);
+        v.sort_merge();
+        int r = 0;
+        for (Node* x = _head; x; x = x->next)
+            for (int i = 0; i < x->count; ++i) x->elem[i] = v[r++];
+    }
+};
+
+#endif // UNROLLED_LIST_H
@@ -0,0 +1,53 @@
+#include "../AVL.h"
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+
+// 平衡树基准：顺序、逆序、随机三种插入次序下 BST 与 AVL 的插入、查找耗时和树高
+
+double elapsedMs(clock_t start) {
+    return double(clock() - start) / CLOCKS_PER_SEC * 1000;
+}
+
+template <typename Tree>
+void run(const char* name, const int* keys, int n) {
+    Tree tree;
+    clock_t start = clock();
+    for (int i = 0; i < n; ++i) tree.insert(keys[i]);
+    double insertMs = elapsedMs(start);
+
+    start = clock();
+    int found = 0;
+    for (int i = 0; i < n; ++i) found += tree.search(keys[i]) ? 1 : 0;
+    double searchMs = elapsedMs(start);
+
+    start = clock();
+    int depth = tree.depth();
+    double depthMs = elapsedMs(start);
+
+    cout << name << "\t插入 " << insertMs << " ms\t查找 " << searchMs << " ms\t树高 " << depth
+         << " (" << depthMs << " ms)" << (found == n ? "" : "\t校验失败") << endl;
+}
+
+int main() {
+    const int N = 20000;
+    int* keys = new int[N];
+    const char* orders[] = { "顺序", "逆序", "随机" };
+
+    cout << "=== BST vs AVL (" << N << " 个键) ===" << endl;
+    for (int k = 0; k < 3; ++k) {
+        for (int i = 0; i < N; ++i) keys[i] = (k == 1) ? N - i : i;
+        if (k == 2) {
+            srand(7);
+            for (int i = N - 1; i > 0; --i) swap(keys[i], keys[rand() % (i + 1)]);
+        }
+        cout << "-- " << orders[k] << "插入 --" << endl;
+        run<BST<int> >("BST", keys, N);
+        run<AVL<int> >("AVL", keys, N);
+    }
+
+    delete[] keys;
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "../AVL.h"
+#include "../BPlusTree.h"
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+
+// 有序索引基准：随机键下 AVL 与 B+ 树的插入、查找、删除耗时，以及 B+ 树批量构建与范围扫描
+
+double elapsedMs(clock_t start) {
+    return double(clock() - start) / CLOCKS_PER_SEC * 1000;
+}
+
+struct Summer {
+    long long sum;
+    Summer() : sum(0) {}
+    void operator()(const int& x) { sum += x; }
+};
+
+template <typename Tree>
+void run(const char* name, const int* keys, int n) {
+    Tree tree;
+    clock_t start = clock();
+    for (int i = 0; i < n; ++i) tree.insert(keys[i]);
+    double insertMs = elapsedMs(start);
+
+    start = clock();
+    int found = 0;
+    for (int i = 0; i < n; ++i) found += tree.search(keys[i]) ? 1 : 0;
+    double searchMs = elapsedMs(start);
+
+    int depth = tree.depth();
+
+    start = clock();
+    for (int i = 0; i < n; i += 2) tree.remove(keys[i]);
+    double removeMs = elapsedMs(start);
+
+    cout << name << "\t插入 " << insertMs << " ms\t查找 " << searchMs << " ms\t删除 " << removeMs
+         << " ms\t树高 " << depth << (found == n ? "" : "\t校验失败") << endl;
+}
+
+int main() {
+    const int N = 1000000;
+    int* keys = new int[N];
+    for (int i = 0; i < N; ++i) keys[i] = i;
+    srand(7);
+    for (int i = N - 1; i > 0; --i) swap(keys[i], keys[(rand() * (RAND_MAX + 1LL) + rand()) % (i + 1)]);
+
+    cout << "=== AVL vs B+树 (" << N << " 个随机键) ===" << endl;
+    run<AVL<int> >("AVL", keys, N);
+    run<BPlusTree<int> >("B+树", keys, N);
+
+    Vector<int> sorted(N);
+    for (int i = 0; i < N; ++i) sorted.push_back(i);
+    clock_t start = clock();
+    BPlusTree<int> bulk(sorted);
+    double buildMs = elapsedMs(start);
+
+    start = clock();
+    Summer sum;
+    bulk.range(N / 4, N / 4 * 3, sum);
+    double rangeMs = elapsedMs(start);
+
+    cout << "B+树批量构建 " << buildMs << " ms\t树高 " << bulk.depth() << endl;
+    cout << "B+树范围扫描 [" << N / 4 << ", " << N / 4 * 3 << "] " << rangeMs << " ms\t和 " << sum.sum << endl;
+
+    delete[] keys;
+    return 0;
+}
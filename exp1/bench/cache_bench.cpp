@@ -0,0 +1,122 @@
+#include "../Cache.h"
+#include "../List.h"
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+using namespace std;
+
+// 缓存基准：Zipf 分布的键流，比较命中率与吞吐量
+// 对照组为直接在 List 上用 find 查找的手写 LRU，每次命中都要线性扫描
+
+double elapsedMs(clock_t start) {
+    return double(clock() - start) / CLOCKS_PER_SEC * 1000;
+}
+
+// Zipf 分布采样：预先计算累积分布，二分查找
+class Zipf {
+private:
+    double* _cdf;
+    int _n;
+public:
+    Zipf(int n, double s) : _n(n) {
+        _cdf = new double[n];
+        double sum = 0;
+        for (int i = 0; i < n; ++i) {
+            sum += 1.0 / pow(i + 1, s);
+            _cdf[i] = sum;
+        }
+        for (int i = 0; i < n; ++i) _cdf[i] /= sum;
+    }
+    ~Zipf() { delete[] _cdf; }
+    int next() {
+        double u = (rand() + 0.5) / (RAND_MAX + 1.0);
+        int lo = 0, hi = _n - 1;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (_cdf[mid] < u) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+};
+
+// 按字节计容量：键值对的近似内存占用
+struct ByteWeight {
+    size_t operator()(const int&, const string& v) const { return sizeof(int) + v.size(); }
+};
+
+// 手写 LRU：List 中按最近使用次序保存键，find 线性查找
+struct NaiveLRU {
+    List<int> list;
+    int capacity;
+    long hits, misses;
+    NaiveLRU(int cap) : capacity(cap), hits(0), misses(0) {}
+    void access(int key) {
+        ListNode<int>* p = list.find(key);
+        if (p) {
+            hits++;
+            list.remove(p);
+        } else {
+            misses++;
+            if (list.size() >= capacity) list.remove(list.last());
+        }
+        list.insertAsFirst(key);
+    }
+};
+
+template <typename Cache>
+void run(const char* name, Cache& cache, const int* keys, int n) {
+    clock_t start = clock();
+    for (int i = 0; i < n; ++i) {
+        if (!cache.get(keys[i])) cache.put(keys[i], keys[i]);
+    }
+    double ms = elapsedMs(start);
+    const CacheStats& s = cache.stats();
+    cout << name << "\t命中率 " << s.hitRatio() * 100 << "%\t淘汰 " << s.evictions
+         << "\t" << ms << " ms" << endl;
+}
+
+int main() {
+    srand(42);
+    const int KEYS = 100000, N = 1000000;
+    int* keys = new int[N];
+
+    for (int k = 0; k < 2; ++k) {
+        double skew = k == 0 ? 0.8 : 1.1;
+        Zipf zipf(KEYS, skew);
+        for (int i = 0; i < N; ++i) keys[i] = zipf.next();
+        // 在键流中间插入一段一次性顺序扫描，检验 SLRU 的抗扫描能力
+        for (int i = N / 2; i < N / 2 + 20000; ++i) keys[i] = KEYS + i;
+
+        cout << "\n=== Zipf s=" << skew << ", " << KEYS << " 个键, " << N << " 次访问 ===" << endl;
+        for (int cap = 1000; cap <= 10000; cap *= 10) {
+            cout << "-- 容量 " << cap << " --" << endl;
+            LRUCache<int, int> lru(cap);
+            SLRUCache<int, int> slru(cap);
+            run("LRU ", lru, keys, N);
+            run("SLRU", slru, keys, N);
+        }
+    }
+
+    // 对照组：List::find 线性查找（只跑一小段，否则耗时过长）
+    const int NAIVE = 20000;
+    NaiveLRU naive(1000);
+    clock_t start = clock();
+    for (int i = 0; i < NAIVE; ++i) naive.access(keys[i]);
+    cout << "\n手写 List LRU (容量 1000, " << NAIVE << " 次访问): " << elapsedMs(start) << " ms" << endl;
+
+    // 按字节计容量
+    LRUCache<int, string, ByteWeight> bytes(64 * 1024);
+    for (int i = 0; i < 100000; ++i) {
+        int key = keys[i];
+        if (!bytes.get(key)) bytes.put(key, string(key % 100 + 1, 'x'));
+    }
+    cout << "按字节计容量 (64KB): 条目 " << bytes.size() << ", 字节 " << bytes.weight()
+         << ", 命中率 " << bytes.stats().hitRatio() * 100 << "%" << endl;
+
+    delete[] keys;
+    return 0;
+}
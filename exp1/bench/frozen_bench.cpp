@@ -0,0 +1,62 @@
+#include "../FrozenBST.h"
+#include "../Vector.h"
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+
+using namespace std;
+
+// 冻结布局基准：随机插入建成的大BST上，BST::search、有序数组二分与Eytzinger数组的查找吞吐
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    const int N = 4000000;  // 节点约160MB，远大于末级缓存
+    const int Q = 4000000;
+    srand(2025);
+    int* keys = new int[N];
+    for (int i = 0; i < N; ++i) keys[i] = 2 * i;  // 偶数键，奇数查询必然落空
+    for (int i = N - 1; i > 0; --i) swap(keys[i], keys[rand() % (i + 1)]);
+    int* queries = new int[Q];
+    for (int i = 0; i < Q; ++i) queries[i] = rand() % (2 * N);
+
+    BST<int> tree;
+    for (int i = 0; i < N; ++i) tree.insert(keys[i]);
+    cout << "=== " << N << " 个键（树高 " << tree.depth() << "）, " << Q << " 次随机查找 ===" << endl;
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    FrozenBST<int> frozen = freeze(tree);
+    cout << "freeze\t" << elapsedMs(start) << " ms" << endl;
+    Vector<int> sorted = tree.flatten();
+
+    start = chrono::steady_clock::now();
+    int treeHits = 0;
+    for (int i = 0; i < Q; ++i) treeHits += tree.search(queries[i]) ? 1 : 0;
+    double treeMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    int arrayHits = 0;
+    const int* a = &sorted[0];
+    for (int i = 0; i < Q; ++i) {
+        const int* p = lower_bound(a, a + N, queries[i]);
+        arrayHits += (p != a + N && *p == queries[i]) ? 1 : 0;
+    }
+    double arrayMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    int frozenHits = 0;
+    for (int i = 0; i < Q; ++i) frozenHits += frozen.search(queries[i]) ? 1 : 0;
+    double frozenMs = elapsedMs(start);
+
+    bool ok = treeHits == arrayHits && treeHits == frozenHits;
+    cout << "BST::search\t" << treeMs << " ms" << endl;
+    cout << "有序数组二分\t" << arrayMs << " ms\t" << treeMs / arrayMs << "x" << endl;
+    cout << "Eytzinger\t" << frozenMs << " ms\t" << treeMs / frozenMs << "x" << (ok ? "" : "\t校验失败") << endl;
+
+    delete[] keys;
+    delete[] queries;
+    return 0;
+}
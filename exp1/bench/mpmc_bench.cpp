@@ -0,0 +1,98 @@
+#include "../MPMCQueue.h"
+#include "../Queue.h"
+#include <iostream>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <atomic>
+#include <chrono>
+
+using namespace std;
+
+// 竞争基准：P 个生产者与 C 个消费者共同搬运 TOTAL 个元素
+// 对比 MPMCQueue 与“互斥锁 + Queue<T>”两种实现的吞吐量
+
+const int TOTAL = 1 << 20;
+
+// 互斥锁保护的 Queue<T>，作为对照组
+class LockedQueue {
+private:
+    Queue<int> _q;
+    mutex _m;
+public:
+    bool try_enqueue(int e) {
+        lock_guard<mutex> g(_m);
+        _q.enqueue(e);
+        return true;
+    }
+    bool try_dequeue(int& e) {
+        lock_guard<mutex> g(_m);
+        if (_q.empty()) return false;
+        e = _q.dequeue();
+        return true;
+    }
+};
+
+template <typename Q>
+double run(Q& q, int producers, int consumers) {
+    atomic<long long> sum(0);
+    atomic<int> consumed(0);
+    vector<thread> threads;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    for (int p = 0; p < producers; ++p) {
+        threads.push_back(thread([&, p]() {
+            for (int i = p; i < TOTAL; i += producers) {
+                while (!q.try_enqueue(i)) this_thread::yield();
+            }
+        }));
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.push_back(thread([&]() {
+            long long local = 0;
+            int e;
+            while (consumed.load(memory_order_relaxed) < TOTAL) {
+                if (q.try_dequeue(e)) {
+                    local += e;
+                    consumed.fetch_add(1, memory_order_relaxed);
+                } else {
+                    this_thread::yield();
+                }
+            }
+            sum += local;
+        }));
+    }
+    for (size_t i = 0; i < threads.size(); ++i) threads[i].join();
+
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    long long expected = (long long)TOTAL * (TOTAL - 1) / 2;
+    if (sum != expected) cout << "  校验失败: " << sum << " != " << expected << endl;
+    return ms;
+}
+
+int main() {
+    cout << "=== MPMC 队列竞争基准 (" << TOTAL << " 个元素) ===" << endl;
+    cout << "线程数\tMPMCQueue(ms)\t互斥锁Queue(ms)" << endl;
+
+    for (int threads = 2; threads <= 64; threads *= 2) {
+        int producers = threads / 2, consumers = threads - producers;
+        MPMCQueue<int> lockFree(4096);
+        LockedQueue locked;
+        double a = run(lockFree, producers, consumers);
+        double b = run(locked, producers, consumers);
+        cout << threads << "\t" << a << "\t\t" << b << endl;
+    }
+
+    // 单线程：批量接口往返
+    MPMCQueue<int> q(1024);
+    int buf[64];
+    for (int i = 0; i < 64; ++i) buf[i] = i;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int round = 0; round < TOTAL / 64; ++round) {
+        q.try_enqueue_bulk(buf, 64);
+        q.try_dequeue_bulk(buf, 64);
+    }
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << "1 (批量 64)\t" << ms << endl;
+    return 0;
+}
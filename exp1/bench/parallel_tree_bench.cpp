@@ -0,0 +1,86 @@
+#include "../ParallelTree.h"
+#include <iostream>
+#include <chrono>
+#include <string>
+
+using namespace std;
+
+// 并行树操作基准：平衡树上顺序与 fork/join 版本的复制、归约、求高、清空耗时
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+struct Sum {
+    long long operator()(long long a, long long b) const { return a + b; }
+};
+
+struct Self {
+    long long operator()(const int& x) const { return x; }
+};
+
+struct Accumulate {
+    long long sum;
+    Accumulate() : sum(0) {}
+    void operator()(const int& x) { sum += x; }
+};
+
+int main() {
+    const int N = 4000000;
+    ThreadPool& pool = ThreadPool::instance();
+    cout << "=== 并行树操作 (" << N << " 个节点, " << pool.size() << " 个工作线程) ===" << endl;
+
+    Vector<int> sorted(N);
+    for (int i = 0; i < N; ++i) sorted.push_back(i);
+    BST<int> tree;
+    tree.build_from_sorted(sorted);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    BST<int> seqCopy(tree);
+    double seqCopyMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    BST<int> parCopy;
+    parallel_copy(parCopy, tree);
+    double parCopyMs = elapsedMs(start);
+    cout << "复制\t顺序 " << seqCopyMs << " ms\t并行 " << parCopyMs << " ms" << endl;
+
+    start = chrono::steady_clock::now();
+    Accumulate acc;
+    tree.inOrder(acc);
+    double seqSumMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    long long parSum = parallel_reduce(tree, 0LL, Self(), Sum());
+    double parSumMs = elapsedMs(start);
+    cout << "求和\t顺序 " << seqSumMs << " ms\t并行 " << parSumMs << " ms"
+         << (acc.sum == parSum ? "" : "\t校验失败") << endl;
+
+    start = chrono::steady_clock::now();
+    int seqDepth = tree.depth(tree.getRoot());
+    double seqDepthMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    int parDepth = parallel_depth(tree);
+    double parDepthMs = elapsedMs(start);
+    cout << "求高\t顺序 " << seqDepthMs << " ms\t并行 " << parDepthMs << " ms"
+         << (seqDepth == parDepth ? "" : "\t校验失败") << endl;
+
+    // 元素需要析构时才有并行清空的必要
+    Vector<string> words(N / 4);
+    for (int i = 0; i < N / 4; ++i) words.push_back("key-" + to_string(1000000000 + i) + "-padding-to-defeat-sso");
+    BST<string> a, b;
+    a.build_from_sorted(words);
+    b.build_from_sorted(words);
+
+    start = chrono::steady_clock::now();
+    a.clear();
+    double seqClearMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    parallel_clear(b);
+    double parClearMs = elapsedMs(start);
+    cout << "清空(string, " << N / 4 << ")\t顺序 " << seqClearMs << " ms\t并行 " << parClearMs << " ms" << endl;
+
+    return 0;
+}
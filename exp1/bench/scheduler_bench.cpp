@@ -0,0 +1,72 @@
+#include "../ThreadPool.h"
+#include <iostream>
+#include <atomic>
+#include <chrono>
+
+using namespace std;
+
+// 调度开销基准：空任务的 spawn/sync 成本、parallel_for 在不同粒度下的开销、fork/join 递归
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// fork/join 递归斐波那契，n 小于 cutoff 时串行
+long fib(int n, int cutoff) {
+    if (n < 2) return n;
+    if (n < cutoff) return fib(n - 1, cutoff) + fib(n - 2, cutoff);
+    long a = 0;
+    TaskGroup g;
+    g.spawn([&a, n, cutoff]() { a = fib(n - 1, cutoff); });
+    long b = fib(n - 2, cutoff);
+    g.sync();
+    return a + b;
+}
+
+int main() {
+    ThreadPool& pool = ThreadPool::instance();
+    cout << "=== 工作窃取调度器开销基准 (" << pool.size() << " 个工作线程) ===" << endl;
+
+    // 1. 空任务的 spawn + sync
+    const int TASKS = 200000;
+    atomic<int> counter(0);
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    {
+        TaskGroup g;
+        for (int i = 0; i < TASKS; ++i) g.spawn([&counter]() { counter.fetch_add(1, memory_order_relaxed); });
+        g.sync();
+    }
+    double ms = elapsedMs(start);
+    cout << "spawn/sync: " << TASKS << " 个空任务 " << ms << " ms, 每任务 "
+         << ms * 1e6 / TASKS << " ns" << (counter == TASKS ? "" : " 校验失败") << endl;
+
+    // 2. parallel_for 不同粒度
+    const int N = 1 << 22;
+    Vector<int> data(N);
+    for (int i = 0; i < N; ++i) data.push_back(i & 1023);
+
+    start = chrono::steady_clock::now();
+    long serial = 0;
+    for (int i = 0; i < N; ++i) serial += data[i];
+    cout << "串行求和: " << elapsedMs(start) << " ms" << endl;
+
+    for (int grain = 64; grain <= (1 << 18); grain *= 8) {
+        atomic<long> sum(0);
+        start = chrono::steady_clock::now();
+        parallel_for(0, N / grain, 1, [&](int b) {
+            long local = 0;
+            for (int i = b * grain; i < (b + 1) * grain; ++i) local += data[i];
+            sum.fetch_add(local, memory_order_relaxed);
+        });
+        cout << "parallel_for 粒度 " << grain << ": " << elapsedMs(start) << " ms"
+             << (sum == serial ? "" : " 校验失败") << endl;
+    }
+
+    // 3. fork/join 递归
+    for (int cutoff = 10; cutoff <= 25; cutoff += 5) {
+        start = chrono::steady_clock::now();
+        long r = fib(30, cutoff);
+        cout << "fib(30) 串行阈值 " << cutoff << ": " << elapsedMs(start) << " ms (" << r << ")" << endl;
+    }
+    return 0;
+}
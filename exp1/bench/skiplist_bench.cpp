@@ -0,0 +1,64 @@
+#include "../SkipList.h"
+#include "../List.h"
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+
+// 随机按秩访问基准：List::operator[] 逐个节点前进 O(r)，SkipList::at 沿跨度下降 O(log n)
+
+double elapsedMs(clock_t start) {
+    return double(clock() - start) / CLOCKS_PER_SEC * 1000;
+}
+
+int main() {
+    srand(12345);
+    cout << "=== 随机秩访问: List vs SkipList ===" << endl;
+    cout << "规模\t查询数\tList(ms)\tSkipList(ms)" << endl;
+
+    for (int n = 1000; n <= 64000; n *= 4) {
+        const int queries = 20000;
+        List<int> list;
+        SkipList<int> skip;
+        for (int i = 0; i < n; ++i) {
+            list.insertAsLast(i * 2);
+            skip.insert(i * 2);
+        }
+
+        int* ranks = new int[queries];
+        for (int i = 0; i < queries; ++i) ranks[i] = rand() % n;
+
+        long sumList = 0, sumSkip = 0;
+        clock_t start = clock();
+        for (int i = 0; i < queries; ++i) sumList += list[ranks[i]];
+        double listMs = elapsedMs(start);
+
+        start = clock();
+        for (int i = 0; i < queries; ++i) sumSkip += skip.at(ranks[i]);
+        double skipMs = elapsedMs(start);
+
+        cout << n << "\t" << queries << "\t" << listMs << "\t\t" << skipMs;
+        if (sumList != sumSkip) cout << "\t校验失败";
+        cout << endl;
+        delete[] ranks;
+    }
+
+    // 随机插入、删除与求秩
+    const int N = 200000;
+    SkipList<int> skip;
+    clock_t start = clock();
+    for (int i = 0; i < N; ++i) skip.insert(rand());
+    cout << "\nSkipList 随机插入 " << N << " 个: " << elapsedMs(start) << " ms" << endl;
+
+    start = clock();
+    long check = 0;
+    for (int i = 0; i < N; ++i) check += skip.rank(skip.at(rand() % skip.size()));
+    cout << "SkipList at + rank " << N << " 次: " << elapsedMs(start) << " ms" << endl;
+
+    start = clock();
+    int removed = 0;
+    for (int i = 0; i < N / 2; ++i) removed += skip.remove(skip.at(rand() % skip.size())) ? 1 : 0;
+    cout << "SkipList 按秩删除 " << removed << " 个: " << elapsedMs(start) << " ms" << endl;
+    return check < 0;
+}
@@ -0,0 +1,66 @@
+#include "../AVL.h"
+#include "../Splay.h"
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+using namespace std;
+
+// 伸展树基准：Zipf 分布（少数热点键占多数访问）与均匀分布的查找下，BST、AVL 与伸展树的耗时
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// 按 Zipf(s) 分布生成 q 个 [0, n) 内的秩：秩 r 被抽中的概率正比于 1 / (r + 1)^s
+void zipf(int* out, int q, int n, double s) {
+    double* cdf = new double[n];
+    double sum = 0;
+    for (int r = 0; r < n; ++r) cdf[r] = (sum += 1.0 / pow(r + 1.0, s));
+    for (int i = 0; i < q; ++i) {
+        double u = (double)rand() / RAND_MAX * sum;
+        int r = (int)(lower_bound(cdf, cdf + n, u) - cdf);
+        out[i] = r < n ? r : n - 1;
+    }
+    delete[] cdf;
+}
+
+template <typename Tree>
+void run(const char* name, const int* keys, int n, const int* queries, int q) {
+    Tree tree;
+    for (int i = 0; i < n; ++i) tree.insert(keys[i]);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    int found = 0;
+    for (int i = 0; i < q; ++i) found += tree.search(queries[i]) ? 1 : 0;
+    double searchMs = elapsedMs(start);
+
+    cout << name << "\t查找 " << searchMs << " ms\t树高 " << tree.depth() << (found == q ? "" : "\t校验失败") << endl;
+}
+
+int main() {
+    const int N = 1000000;
+    const int Q = 2000000;
+    int* keys = new int[N];
+    int* queries = new int[Q];
+    srand(7);
+    for (int i = 0; i < N; ++i) keys[i] = i;
+    for (int i = N - 1; i > 0; --i) swap(keys[i], keys[rand() % (i + 1)]);
+
+    const double skews[] = { 0.0, 1.0, 1.2 };
+    for (int k = 0; k < 3; ++k) {
+        zipf(queries, Q, N, skews[k]);
+        for (int i = 0; i < Q; ++i) queries[i] = keys[queries[i]];  // 热点键散布在整个键空间
+        cout << "=== " << N << " 个键, " << Q << " 次查找, Zipf s = " << skews[k]
+             << (skews[k] == 0 ? "（均匀）" : "") << " ===" << endl;
+        run<BST<int> >("BST", keys, N, queries, Q);
+        run<AVL<int> >("AVL", keys, N, queries, Q);
+        run<Splay<int> >("Splay", keys, N, queries, Q);
+    }
+
+    delete[] keys;
+    delete[] queries;
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "../List.h"
+#include <iostream>
+#include <ctime>
+
+using namespace std;
+
+// 拼接基准：共享节点池的两个列表之间移动节点（逐个 splice、整表 splice、split_at、merge）
+// 节点只重新链接而不复制，移动前取得的节点指针在移动后仍指向同一元素；
+// 最后对比不共享节点池时逐个复制的开销
+
+double elapsedMs(clock_t start) {
+    return double(clock() - start) / CLOCKS_PER_SEC * 1000;
+}
+
+int main() {
+    const int N = 1000000;
+    cout << "=== List 拼接 (" << N << " 个元素) ===" << endl;
+    List<int> a;
+    List<int> b(a.pool());
+    for (int i = 0; i < N; ++i) b.insertAsLast(2 * i);
+
+    // 1. 逐个把 b 的首节点移到 a 的末尾
+    bool same = true;
+    clock_t start = clock();
+    for (int i = 0; i < N; ++i) {
+        ListNode<int>* x = b.first();
+        a.splice(a.last()->next, b, x);
+        same = same && a.last() == x && x->data == 2 * i;
+    }
+    cout << "逐个 splice\t" << elapsedMs(start) << " ms"
+         << (same && b.empty() && a.size() == N ? "" : "\t校验失败") << endl;
+
+    // 2. 分割后整表拼回
+    ListNode<int>* mid = a.first();
+    for (int i = 0; i < N / 2; ++i) mid = mid->next;
+    start = clock();
+    a.split_at(N / 2, b);
+    ListNode<int>* head = b.first();
+    a.splice(a.last()->next, b);
+    double ms = elapsedMs(start);
+    cout << "split_at + splice\t" << ms << " ms"
+         << (head == mid && b.empty() && a.size() == N ? "" : "\t校验失败") << endl;
+
+    // 3. 归并两个有序表：b 为奇数，归并后依次为 0, 1, 2, ...
+    for (int i = 0; i < N; ++i) b.insertAsLast(2 * i + 1);
+    ListNode<int>* odd = b.first();
+    start = clock();
+    a.merge(b);
+    ms = elapsedMs(start);
+    bool sorted = b.empty() && a.size() == 2 * N && a.first()->next == odd;
+    int k = 0;
+    for (ListNode<int>* p = a.first(); sorted && k < 2 * N; p = p->next, ++k) sorted = p->data == k;
+    cout << "merge\t" << ms << " ms" << (sorted ? "" : "\t校验失败") << endl;
+
+    // 4. 节点池不同：逐个复制到目标列表的节点池
+    List<int> c;
+    start = clock();
+    c.splice(c.first(), a);
+    ms = elapsedMs(start);
+    cout << "跨节点池 splice\t" << ms << " ms" << (a.empty() && c.size() == 2 * N ? "" : "\t校验失败") << endl;
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include "../AVL.h"
+#include "../TreeFile.h"
+#include "../Vector.h"
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+
+using namespace std;
+
+// 热启动基准：把 AVL 树存盘后，分别以逐个 insert、按结构加载、按升序加载、映射查询四种方式恢复
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    const int N = 2000000;
+    const int Q = 1000000;
+    const char* structPath = "treefile_bench_struct.bin";
+    const char* sortedPath = "treefile_bench_sorted.bin";
+    cout << "=== 树的存盘与恢复 (" << N << " 个关键码) ===" << endl;
+
+    srand(12345);
+    Vector<int> keys(N);
+    for (int i = 0; i < N; ++i) keys.push_back(rand());
+    AVL<int> tree;
+    for (int i = 0; i < N; ++i) tree.insert(keys[i]);
+
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    TreeFile<int>::save(tree, structPath);
+    TreeFile<int>::saveSorted(tree, sortedPath);
+    cout << "存盘（两种格式）\t" << elapsedMs(start) << " ms" << endl;
+
+    start = chrono::steady_clock::now();
+    AVL<int> rebuilt;
+    for (int i = 0; i < N; ++i) rebuilt.insert(keys[i]);
+    cout << "逐个insert重建\t" << elapsedMs(start) << " ms" << endl;
+
+    start = chrono::steady_clock::now();
+    AVL<int> loaded;
+    bool ok = TreeFile<int>::load(loaded, structPath);
+    cout << "按结构加载\t" << elapsedMs(start) << " ms" << (ok && loaded.depth(loaded.getRoot()) == tree.depth(tree.getRoot()) ? "" : "\t校验失败") << endl;
+
+    start = chrono::steady_clock::now();
+    AVL<int> balanced;
+    ok = TreeFile<int>::loadSorted(balanced, sortedPath);
+    cout << "按升序加载\t" << elapsedMs(start) << " ms" << (ok && balanced.getSize() == tree.getSize() ? "" : "\t校验失败") << endl;
+
+    start = chrono::steady_clock::now();
+    MappedTree<int> mapped;
+    ok = mapped.open(sortedPath);
+    cout << "映射打开\t" << elapsedMs(start) << " ms" << (ok ? "" : "\t失败") << endl;
+
+    int treeHits = 0, mappedHits = 0;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < Q; ++i) treeHits += loaded.search(keys[i % N] + (i & 1)) != nullptr;
+    double treeMs = elapsedMs(start);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < Q; ++i) mappedHits += mapped.search(keys[i % N] + (i & 1)) != nullptr;
+    double mappedMs = elapsedMs(start);
+    cout << Q << " 次查找\t树 " << treeMs << " ms\t映射 " << mappedMs << " ms"
+         << (treeHits == mappedHits ? "" : "\t校验失败") << endl;
+
+    mapped.close();
+    remove(structPath);
+    remove(sortedPath);
+    return 0;
+}
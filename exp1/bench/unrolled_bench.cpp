@@ -0,0 +1,82 @@
+#include "../UnrolledList.h"
+#include "../List.h"
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+
+using namespace std;
+
+// 展开链表基准：顺序遍历与随机位置插入，对比 List
+
+double elapsedMs(clock_t start) {
+    return double(clock() - start) / CLOCKS_PER_SEC * 1000;
+}
+
+long total = 0;
+void addTo(int& e) { total += e; }
+
+int main() {
+    srand(2024);
+    cout << "=== 展开链表 vs List ===" << endl;
+
+    // 1. 顺序遍历：先随机插入打散 List 节点的内存布局，再遍历多次
+    const int N = 1000000;
+    List<int> list;
+    UnrolledList<int> unrolled;
+    for (int i = 0; i < N; ++i) {
+        int e = rand() % 1000;
+        if (rand() & 1) {
+            list.insertAsFirst(e);
+            unrolled.insertAsFirst(e);
+        } else {
+            list.insertAsLast(e);
+            unrolled.insertAsLast(e);
+        }
+    }
+
+    const int ROUNDS = 20;
+    total = 0;
+    clock_t start = clock();
+    for (int k = 0; k < ROUNDS; ++k) list.traverse(addTo);
+    double listMs = elapsedMs(start);
+    long listTotal = total;
+
+    total = 0;
+    start = clock();
+    for (int k = 0; k < ROUNDS; ++k) unrolled.traverse(addTo);
+    double unrolledMs = elapsedMs(start);
+
+    cout << "遍历 " << N << " 个元素 x " << ROUNDS << " 次: List " << listMs
+         << " ms, UnrolledList " << unrolledMs << " ms"
+         << (listTotal == total ? "" : " 校验失败") << endl;
+
+    // 2. 随机位置插入：两者都需先走到插入位置，List 每步一个节点，展开链表每步一整块
+    const int M = 50000, INSERTS = 5000;
+    List<int> smallList;
+    UnrolledList<int> smallUnrolled;
+    for (int i = 0; i < M; ++i) {
+        smallList.insertAsLast(i);
+        smallUnrolled.insertAsLast(i);
+    }
+
+    int* ranks = new int[INSERTS];
+    for (int i = 0; i < INSERTS; ++i) ranks[i] = rand() % (M + i);
+
+    start = clock();
+    for (int i = 0; i < INSERTS; ++i) {
+        ListNode<int>* p = smallList.first();
+        for (int j = 0; j < ranks[i]; ++j) p = p->next;
+        smallList.insertBefore(p, -i);
+    }
+    listMs = elapsedMs(start);
+
+    start = clock();
+    for (int i = 0; i < INSERTS; ++i) smallUnrolled.insert(ranks[i], -i);
+    unrolledMs = elapsedMs(start);
+
+    cout << "随机位置插入 " << INSERTS << " 次 (初始规模 " << M << "): List " << listMs
+         << " ms, UnrolledList " << unrolledMs << " ms" << endl;
+
+    delete[] ranks;
+    return 0;
+}